@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -8,6 +11,7 @@
 #include <mutex>
 #include <random>
 #include <ranges>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -17,6 +21,11 @@
 
 #include <zcrc/zcrc.hpp>
 
+#ifdef ZCRC_BENCHMARK_ZLIB
+#include <zlib.h>
+#include <zcrc/zlib.hpp>
+#endif
+
 namespace {
 
 [[nodiscard]] std::vector<std::uint8_t> generate_random_data(
@@ -83,6 +92,14 @@ TEST_CASE("512 MiB parallel CRC32C slice-by-8") {
         return zcrc::crc32c::compute(zcrc::parallel<zcrc::slice_by<8>>, random_data);
     };
 
+    BENCHMARK("zcrc::parallel, 1 MiB tasks") {
+        return zcrc::crc32c::compute(zcrc::parallel<zcrc::slice_by<8>, 1 << 20>, random_data);
+    };
+
+    BENCHMARK("zcrc::numa_parallel") {
+        return zcrc::crc32c::compute(zcrc::numa_parallel<zcrc::slice_by<8>>, random_data);
+    };
+
     for (const auto i : std::views::iota(2U, std::jthread::hardware_concurrency() + 1)) {
         BENCHMARK(std::format("{} threads", i)) {
             return compute<zcrc::crc32c>(zcrc::slice_by<8>, i, random_data);
@@ -90,6 +107,53 @@ TEST_CASE("512 MiB parallel CRC32C slice-by-8") {
     }
 }
 
+TEST_CASE("16 MiB working set beside a 512 MiB scan") {
+    const auto random_data {generate_random_data(1 << 29)};
+    const std::vector<std::uint64_t> working_set(std::size_t {1} << 21, 1);
+    const auto pass {[&] {
+        std::uint64_t sum {0};
+        for (std::size_t i {0}; i < working_set.size(); i += 8) {
+            sum += working_set[i];
+        }
+        return sum;
+    }};
+    std::atomic<std::uint32_t> sink {};
+
+    BENCHMARK("alone") {
+        return pass();
+    };
+
+    {
+        const std::jthread scanner {[&] (const std::stop_token stop) {
+            while (!stop.stop_requested()) {
+                sink.store(zcrc::crc32c::compute(zcrc::native, random_data), std::memory_order_relaxed);
+            }
+        }};
+        BENCHMARK("beside zcrc::native") {
+            return pass();
+        };
+    }
+
+    {
+        const std::jthread scanner {[&] (const std::stop_token stop) {
+            while (!stop.stop_requested()) {
+                sink.store(zcrc::crc32c::compute(zcrc::streaming<zcrc::native>, random_data), std::memory_order_relaxed);
+            }
+        }};
+        BENCHMARK("beside zcrc::streaming<zcrc::native>") {
+            return pass();
+        };
+    }
+
+    BENCHMARK("zcrc::native scan") {
+        return zcrc::crc32c::compute(zcrc::native, random_data);
+    };
+
+    BENCHMARK("zcrc::streaming<zcrc::native> scan") {
+        return zcrc::crc32c::compute(zcrc::streaming<zcrc::native>, random_data);
+    };
+}
+
 namespace {
 
 struct null_terminator_sentinel {
@@ -118,3 +182,418 @@ TEST_CASE("cstr") {
         }
     }
 }
+
+TEST_CASE("1 MiB noncontiguous input") {
+    const auto random_data {generate_random_data(1 << 20)};
+
+    BENCHMARK("contiguous") {
+        return zcrc::crc32c::compute(random_data);
+    };
+
+    BENCHMARK("views::transform") {
+        return zcrc::crc32c::compute(random_data | std::views::transform([] (const std::uint8_t b) { return b; }));
+    };
+
+    BENCHMARK("views::filter") {
+        return zcrc::crc32c::compute(random_data | std::views::filter([] (std::uint8_t) { return true; }));
+    };
+}
+
+TEST_CASE("1 MiB of 16-bit words") {
+    const auto random_data {generate_random_data(1 << 20)};
+    std::vector<std::int16_t> words(random_data.size() / 2);
+    std::memcpy(words.data(), random_data.data(), random_data.size());
+
+    BENCHMARK("copy to big-endian bytes + compute") {
+        std::vector<std::uint8_t> bytes(random_data.size());
+        for (std::size_t i {0}; i < words.size(); ++i) {
+            bytes[2 * i] = static_cast<std::uint8_t>(static_cast<std::uint16_t>(words[i]) >> 8);
+            bytes[(2 * i) + 1] = static_cast<std::uint8_t>(words[i]);
+        }
+        return zcrc::crc32c::compute(bytes);
+    };
+
+    BENCHMARK("as_bytes<big>") {
+        return zcrc::crc32c::compute(zcrc::as_bytes<std::endian::big>(words));
+    };
+
+    BENCHMARK("as_bytes<little>") {
+        return zcrc::crc32c::compute(zcrc::as_bytes<std::endian::little>(words));
+    };
+}
+
+TEST_CASE("4 MiB chunked CRC32C") {
+    const auto random_data {generate_random_data(1 << 22)};
+
+    for (const std::size_t chunk_size : {512, 4096}) {
+        std::vector<std::uint32_t> crcs((random_data.size() + chunk_size - 1) / chunk_size);
+
+        BENCHMARK(std::format("{}: compute per chunk", chunk_size)) {
+            for (std::size_t i {0}; i < crcs.size(); ++i) {
+                crcs[i] = zcrc::crc32c::compute(std::span {random_data}.subspan(i * chunk_size, chunk_size));
+            }
+            return crcs.back();
+        };
+
+        BENCHMARK(std::format("{}: compute_chunked", chunk_size)) {
+            zcrc::crc32c::compute_chunked(random_data, chunk_size, crcs);
+            return crcs.back();
+        };
+
+        BENCHMARK(std::format("{}: verify_chunked", chunk_size)) {
+            return zcrc::crc32c::verify_chunked(random_data, chunk_size, crcs);
+        };
+
+        BENCHMARK(std::format("{}: combine_chunked", chunk_size)) {
+            return zcrc::crc32c::combine_chunked(crcs, chunk_size, random_data.size());
+        };
+    }
+}
+
+TEST_CASE("4 MiB protection information") {
+    const auto random_data {generate_random_data(1 << 22)};
+
+    for (const std::size_t sector_size : {512, 4096}) {
+        std::vector<std::uint16_t> tags16(random_data.size() / sector_size);
+        std::vector<std::uint64_t> tags64(random_data.size() / sector_size);
+
+        BENCHMARK(std::format("{}: crc16_t10_dif::compute per sector", sector_size)) {
+            for (std::size_t i {0}; i < tags16.size(); ++i) {
+                tags16[i] = zcrc::crc16_t10_dif::compute(std::span {random_data}.subspan(i * sector_size, sector_size));
+            }
+            return tags16.back();
+        };
+
+        BENCHMARK(std::format("{}: pi::generate (16b guard)", sector_size)) {
+            zcrc::pi::generate(random_data, sector_size, tags16);
+            return tags16.back();
+        };
+
+        BENCHMARK(std::format("{}: crc64_nvme::compute per sector", sector_size)) {
+            for (std::size_t i {0}; i < tags64.size(); ++i) {
+                tags64[i] = zcrc::crc64_nvme::compute(std::span {random_data}.subspan(i * sector_size, sector_size));
+            }
+            return tags64.back();
+        };
+
+        BENCHMARK(std::format("{}: pi::generate (64b guard)", sector_size)) {
+            zcrc::pi::generate(random_data, sector_size, tags64);
+            return tags64.back();
+        };
+
+        BENCHMARK(std::format("{}: pi::verify (64b guard)", sector_size)) {
+            return zcrc::pi::verify(random_data, sector_size, tags64);
+        };
+    }
+}
+
+TEST_CASE("10,000-part composite CRC64/NVME") {
+    std::vector<std::pair<zcrc::crc64_nvme, std::uint64_t>> parts(10'000);
+    std::mt19937_64 rng {std::random_device{}()};
+    for (auto& [state, len] : parts) {
+        state = zcrc::crc64_nvme {zcrc::from_finalized, rng()};
+        len = 8 << 20;
+    }
+    parts.back().second = 12345;
+
+    BENCHMARK("combine and process_zero_bytes") {
+        zcrc::crc64_nvme whole {};
+        for (const auto& [state, len] : parts) {
+            whole = zcrc::combine(zcrc::process_zero_bytes(zcrc::combine(whole, zcrc::crc64_nvme {}), len), state);
+        }
+        return whole;
+    };
+
+    BENCHMARK("compose") {
+        return zcrc::compose(parts);
+    };
+}
+
+TEST_CASE("64-frame Ethernet burst") {
+    for (const std::size_t frame_size : {64, 1518}) {
+        std::vector<std::vector<std::uint8_t>> frames;
+        for (std::size_t i {0}; i < 64; ++i) {
+            auto frame {generate_random_data(frame_size - 4)};
+            const std::uint32_t fcs {zcrc::crc32_iso_hdlc::compute(frame)};
+            for (std::size_t j {0}; j < 4; ++j) {
+                frame.push_back(static_cast<std::uint8_t>(fcs >> (8 * j)));
+            }
+            frames.push_back(std::move(frame));
+        }
+
+        BENCHMARK(std::format("{}: is_valid on each", frame_size)) {
+            std::uint64_t bitmap {0};
+            for (std::size_t i {0}; i < frames.size(); ++i) {
+                bitmap |= static_cast<std::uint64_t>(zcrc::crc32_iso_hdlc::is_valid(frames[i])) << i;
+            }
+            return bitmap;
+        };
+
+        BENCHMARK(std::format("{}: verify_frames", frame_size)) {
+            std::array<std::uint64_t, 1> bitmap {};
+            (void)zcrc::crc32_iso_hdlc::verify_frames(frames, bitmap);
+            return bitmap[0];
+        };
+    }
+}
+
+TEST_CASE("10,000 CAN frames") {
+    // Standard data frames with 8 bytes of payload: 83 bits up to the CRC field.
+    std::vector<std::vector<std::uint8_t>> frames;
+    for (std::size_t i {0}; i < 10'000; ++i) {
+        frames.push_back(generate_random_data(11));
+    }
+    constexpr std::size_t bit_count {83};
+
+    BENCHMARK("bit by bit") {
+        std::uint16_t result {0};
+        for (const auto& frame : frames) {
+            std::uint16_t crc {0};
+            for (std::size_t i {0}; i < bit_count; ++i) {
+                const bool bit {((frame[i / 8] >> (7 - (i % 8))) & 1) != 0};
+                const bool top {((crc >> 14) & 1) != 0};
+                crc = static_cast<std::uint16_t>((crc << 1) & 0x7FFF);
+                if (bit != top) {
+                    crc ^= 0x4599;
+                }
+            }
+            result ^= crc;
+        }
+        return result;
+    };
+
+    BENCHMARK("process_bits") {
+        std::uint16_t result {0};
+        for (const auto& frame : frames) {
+            result ^= zcrc::finalize(zcrc::process_bits(zcrc::crc15_can {}, frame, bit_count));
+        }
+        return result;
+    };
+}
+
+TEST_CASE("4 MiB TFRecord stream") {
+    for (const std::size_t record_size : {256, 4096}) {
+        std::vector<std::uint8_t> stream {};
+        const auto append_le {[&] (std::uint64_t value, const std::size_t bytes) {
+            for (std::size_t i {0}; i < bytes; ++i, value >>= 8) {
+                stream.push_back(static_cast<std::uint8_t>(value & 0xFF));
+            }
+        }};
+        while (stream.size() < (1 << 22)) {
+            const auto data {generate_random_data(record_size)};
+            const std::size_t length_offset {stream.size()};
+            append_le(record_size, 8);
+            append_le(zcrc::masked_crc32c::compute(std::span {stream}.subspan(length_offset, 8)), 4);
+            stream.insert(stream.end(), data.begin(), data.end());
+            append_le(zcrc::masked_crc32c::compute(data), 4);
+        }
+
+        BENCHMARK(std::format("{}: masked_crc32c::compute per record", record_size)) {
+            bool ok {true};
+            for (std::size_t offset {0}; offset < stream.size(); offset += 16 + record_size) {
+                const auto record {std::span {stream}.subspan(offset, 16 + record_size)};
+                std::uint32_t length_crc {};
+                std::uint32_t data_crc {};
+                std::memcpy(&length_crc, record.data() + 8, 4);
+                std::memcpy(&data_crc, record.data() + 12 + record_size, 4);
+                ok &= zcrc::masked_crc32c::compute(record.subspan(0, 8)) == length_crc &&
+                      zcrc::masked_crc32c::compute(record.subspan(12, record_size)) == data_crc;
+            }
+            return ok;
+        };
+
+        BENCHMARK(std::format("{}: tfrecord::verify", record_size)) {
+            return zcrc::tfrecord::verify(stream);
+        };
+    }
+}
+
+TEST_CASE("4 MiB Kafka fetch response") {
+    for (const std::size_t records_size : {256, 16384}) {
+        std::vector<std::uint8_t> response {};
+        const auto append_be {[&] (const std::uint64_t value, const std::size_t bytes) {
+            for (std::size_t i {bytes}; i-- > 0;) {
+                response.push_back(static_cast<std::uint8_t>((value >> (8 * i)) & 0xFF));
+            }
+        }};
+        auto covered {generate_random_data(40 + records_size)};
+        const std::uint32_t crc {zcrc::crc32c::compute(covered)};
+        while (response.size() < (1 << 22)) {
+            append_be(0, 8);                         // Base offset
+            append_be(9 + covered.size(), 4);
+            append_be(0, 4);                         // Partition leader epoch
+            response.push_back(2);                   // Magic
+            append_be(crc, 4);
+            response.insert(response.end(), covered.begin(), covered.end());
+        }
+
+        BENCHMARK(std::format("{}: crc32c::compute per batch", records_size)) {
+            const auto load_be {[&] (const std::size_t offset) {
+                return (std::uint32_t {response[offset]} << 24) | (std::uint32_t {response[offset + 1]} << 16) |
+                       (std::uint32_t {response[offset + 2]} << 8) | response[offset + 3];
+            }};
+            bool ok {true};
+            for (std::size_t offset {0}; response.size() - offset >= 61;) {
+                const std::size_t batch_size {12 + std::size_t {load_be(offset + 8)}};
+                ok &= zcrc::crc32c::compute(std::span {response}.subspan(offset + 21, batch_size - 21)) == load_be(offset + 17);
+                offset += batch_size;
+            }
+            return ok;
+        };
+
+        BENCHMARK(std::format("{}: kafka::verify", records_size)) {
+            return zcrc::kafka::verify(response);
+        };
+    }
+}
+
+TEST_CASE("64 MiB Parquet column chunk") {
+    for (const std::size_t page_size : {8192, 65536}) {
+        std::vector<std::uint8_t> chunk {};
+        const auto varint {[&] (std::uint64_t value) {
+            for (; value >= 0x80; value >>= 7) {
+                chunk.push_back(static_cast<std::uint8_t>((value & 0x7F) | 0x80));
+            }
+            chunk.push_back(static_cast<std::uint8_t>(value));
+        }};
+        const auto data {generate_random_data(page_size)};
+        const std::uint32_t crc {zcrc::crc32_iso_hdlc::compute(data)};
+        while (chunk.size() < (1 << 26)) {
+            // A PageHeader: type, uncompressed_page_size, compressed_page_size, crc, stop.
+            chunk.push_back(0x15);
+            varint(0);
+            for (int i {0}; i < 2; ++i) {
+                chunk.push_back(0x15);
+                varint(page_size << 1);
+            }
+            chunk.push_back(0x15);
+            varint((static_cast<std::uint64_t>(static_cast<std::int32_t>(crc)) << 1) ^ static_cast<std::uint64_t>(static_cast<std::int32_t>(crc) >> 31));
+            chunk.push_back(0);
+            chunk.insert(chunk.end(), data.begin(), data.end());
+        }
+        const std::array chunks {std::pair {std::size_t {0}, chunk.size()}};
+
+        BENCHMARK(std::format("{}: parquet::verify", page_size)) {
+            return zcrc::parquet::verify(chunk, chunks);
+        };
+
+        BENCHMARK(std::format("{}: parquet::verify (parallel)", page_size)) {
+            return zcrc::parquet::verify(zcrc::parallel<zcrc::default_algorithm>, chunk, chunks);
+        };
+    }
+}
+
+TEST_CASE("1 MiB native versus slice-by-8") {
+    const auto random_data {generate_random_data(1 << 20)};
+
+    BENCHMARK("crc32c: slice_by<8>") {
+        return zcrc::crc32c::compute(zcrc::slice_by<8>, random_data);
+    };
+
+    BENCHMARK("crc32c: native") {
+        return zcrc::crc32c::compute(zcrc::native, random_data);
+    };
+
+    BENCHMARK("crc32_iso_hdlc: slice_by<8>") {
+        return zcrc::crc32_iso_hdlc::compute(zcrc::slice_by<8>, random_data);
+    };
+
+    BENCHMARK("crc32_iso_hdlc: native") {
+        return zcrc::crc32_iso_hdlc::compute(zcrc::native, random_data);
+    };
+
+    BENCHMARK("crc64_xz: slice_by<8>") {
+        return zcrc::crc64_xz::compute(zcrc::slice_by<8>, random_data);
+    };
+
+    BENCHMARK("crc64_xz: native") {
+        return zcrc::crc64_xz::compute(zcrc::native, random_data);
+    };
+
+    BENCHMARK("crc16_xmodem: slice_by<8>") {
+        return zcrc::crc16_xmodem::compute(zcrc::slice_by<8>, random_data);
+    };
+
+    BENCHMARK("crc16_xmodem: native") {
+        return zcrc::crc16_xmodem::compute(zcrc::native, random_data);
+    };
+}
+
+// Fieldbus-sized frames. Without PCLMULQDQ, zcrc::native runs one frame per lane of
+// the nibble kernel.
+TEST_CASE("1 MiB of 64-byte frames, narrow CRCs") {
+    const auto random_data {generate_random_data(1 << 20)};
+    constexpr std::size_t frame_size {64};
+    std::vector<std::uint16_t> crcs(random_data.size() / frame_size);
+
+    BENCHMARK("crc16_modbus: slice_by<8>") {
+        zcrc::crc16_modbus::compute_chunked(zcrc::slice_by<8>, random_data, frame_size, crcs);
+        return crcs.back();
+    };
+
+    BENCHMARK("crc16_modbus: native") {
+        zcrc::crc16_modbus::compute_chunked(zcrc::native, random_data, frame_size, crcs);
+        return crcs.back();
+    };
+
+    std::vector<std::uint8_t> crc8s(random_data.size() / frame_size);
+
+    BENCHMARK("crc8_smbus: slice_by<8>") {
+        zcrc::crc8_smbus::compute_chunked(zcrc::slice_by<8>, random_data, frame_size, crc8s);
+        return crc8s.back();
+    };
+
+    BENCHMARK("crc8_smbus: native") {
+        zcrc::crc8_smbus::compute_chunked(zcrc::native, random_data, frame_size, crc8s);
+        return crc8s.back();
+    };
+}
+
+#ifdef ZCRC_BENCHMARK_ZLIB
+// This is what libzcrc-zlib replaces; see src/zlib_shim.cpp.
+TEST_CASE("CRC32/ISO-HDLC versus zlib") {
+    for (std::size_t len {64}; len <= 1 << 20; len <<= 4) {
+        const auto random_data {generate_random_data(len)};
+
+        BENCHMARK(std::format("{}: zcrc", len)) {
+            return zcrc::crc32_iso_hdlc::compute(random_data);
+        };
+
+        BENCHMARK(std::format("{}: zlib", len)) {
+            return ::crc32_z(0, random_data.data(), random_data.size());
+        };
+    }
+}
+
+TEST_CASE("16 MiB gzip member") {
+    // Text-like data, so deflate has something to do.
+    const auto data {generate_random_data(16 << 20, {'a', 'h'})};
+    std::vector<std::uint8_t> member(::compressBound(data.size()) + 18);
+    z_stream stream {};
+    ::deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY);
+    stream.next_in = const_cast<std::uint8_t *>(data.data());
+    stream.avail_in = static_cast<unsigned>(data.size());
+    stream.next_out = member.data();
+    stream.avail_out = static_cast<unsigned>(member.size());
+    ::deflate(&stream, Z_FINISH);
+    member.resize(stream.total_out);
+    ::deflateEnd(&stream);
+
+    BENCHMARK("inflate, then compute") {
+        std::vector<std::uint8_t> out(data.size());
+        z_stream s {};
+        ::inflateInit2(&s, 31);
+        s.next_in = member.data();
+        s.avail_in = static_cast<unsigned>(member.size());
+        s.next_out = out.data();
+        s.avail_out = static_cast<unsigned>(out.size());
+        ::inflate(&s, Z_FINISH);
+        ::inflateEnd(&s);
+        return zcrc::crc32_iso_hdlc::compute(out);
+    };
+
+    BENCHMARK("gzip::verify") {
+        return zcrc::gzip::verify(member, zcrc::zlib_inflate);
+    };
+}
+#endif
@@ -37,20 +37,44 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
+#include <charconv>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <execution>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <system_error>
 #include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_CRC32) || defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#include <arm_acle.h>
+#include <arm_neon.h>
+#endif
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+#if defined(ZCRC_ENABLE_NUMA) && defined(__linux__)
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // This is defined when building as a module.
 #ifndef ZCRC_JUST_THE_INCLUDES
@@ -92,6 +116,54 @@ static_assert(std::endian::native == std::endian::little || std::endian::native
 #define ZCRC_STATIC23
 #endif
 
+// Which hardware kernels we can build (see native_t). On x86-64, GCC and Clang let
+// us compile individual functions for instructions the baseline target lacks, so we
+// check for them at runtime; elsewhere, they must be enabled at compile time.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ZCRC_X86_64_KERNELS
+#define ZCRC_CLMUL_TARGET __attribute__((target("pclmul,sse4.1")))
+#define ZCRC_CRC32_TARGET __attribute__((target("sse4.2")))
+#define ZCRC_NIBBLE_TARGET __attribute__((target("ssse3")))
+#else
+#define ZCRC_CLMUL_TARGET
+#define ZCRC_CRC32_TARGET
+#define ZCRC_NIBBLE_TARGET
+#endif
+#if defined(ZCRC_X86_64_KERNELS) && defined(__AVX2__)
+#define ZCRC_AVX2_KERNELS
+#endif
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define ZCRC_AARCH64_CRC32_KERNELS
+#endif
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#define ZCRC_AARCH64_PMULL_KERNELS
+#endif
+#if defined(__riscv) && __riscv_xlen == 64 && defined(__riscv_zbc)
+#define ZCRC_RISCV_ZBC_KERNELS
+#endif
+#if defined(__powerpc64__) && defined(__POWER8_VECTOR__) && defined(__CRYPTO__)
+#define ZCRC_POWER8_KERNELS
+#endif
+#if defined(__wasm_simd128__)
+#define ZCRC_WASM_SIMD128_KERNELS
+#endif
+#if defined(ZCRC_X86_64_KERNELS) || defined(ZCRC_AARCH64_CRC32_KERNELS)
+#define ZCRC_CRC32_KERNELS
+#endif
+#if defined(ZCRC_X86_64_KERNELS) || defined(ZCRC_WASM_SIMD128_KERNELS)
+#define ZCRC_NIBBLE_KERNELS
+#endif
+#if defined(ZCRC_X86_64_KERNELS) || defined(ZCRC_AARCH64_PMULL_KERNELS) || defined(ZCRC_RISCV_ZBC_KERNELS) || \
+    defined(ZCRC_POWER8_KERNELS)
+#define ZCRC_CLMUL_KERNELS
+#endif
+
+// Whether we can find out which NUMA node memory is on (see numa_parallel_t). This
+// needs a handful of POSIX headers, so it's opt-in: define ZCRC_ENABLE_NUMA first.
+#if defined(ZCRC_ENABLE_NUMA) && defined(__linux__) && defined(SYS_move_pages)
+#define ZCRC_NUMA
+#endif
+
 namespace zcrc::inline v1 {
 
 namespace detail {
@@ -109,29 +181,82 @@ struct slice_by_t : detail::algorithm_base {
     explicit slice_by_t() = default;
 };
 
-ZCRC_EXPORT template <algorithm A>
+// Runs A on every hardware thread. By default, the message is split into one equal
+// chunk per thread. With a nonzero TaskSize, it's split into tasks of that many bytes
+// instead, which threads claim as they free up, so a slow or busy core holds up one
+// task rather than its whole share of the message.
+ZCRC_EXPORT template <algorithm A, std::size_t TaskSize = 0>
 struct parallel_t : detail::algorithm_base {
     explicit parallel_t() = default;
 };
 
-ZCRC_EXPORT template <typename A>
-struct parallel_t<parallel_t<A>> : detail::algorithm_base {
+ZCRC_EXPORT template <typename A, std::size_t InnerTaskSize, std::size_t TaskSize>
+struct parallel_t<parallel_t<A, InnerTaskSize>, TaskSize> : detail::algorithm_base {
     static_assert(false, "zcrc::parallel cannot be nested");
 };
 
+// Like parallel_t, but on Linux machines with more than one NUMA node, each piece of
+// the input is processed by a thread pinned to the node whose memory it's on, rather
+// than wherever the scheduler happens to put it. Elsewhere, it's just parallel_t.
+ZCRC_EXPORT template <algorithm A>
+struct numa_parallel_t : detail::algorithm_base {
+    explicit numa_parallel_t() = default;
+};
+
+ZCRC_EXPORT template <typename A, std::size_t TaskSize>
+struct numa_parallel_t<parallel_t<A, TaskSize>> : detail::algorithm_base {
+    static_assert(sizeof(A) == 0, "zcrc::numa_parallel cannot wrap zcrc::parallel");
+};
+
+// Runs A over the input a block at a time, prefetching Distance bytes ahead with a hint
+// that the data will only be read once, so that a scan of a buffer much larger than
+// the cache doesn't push everything else out of it. How much that helps, if at all,
+// depends on the microarchitecture. Input that fits in the cache is processed more
+// slowly. To use it with threads, put it inside zcrc::parallel, not around it.
+ZCRC_EXPORT template <algorithm A, std::size_t Distance = 4096>
+struct streaming_t : detail::algorithm_base {
+    static_assert(Distance != 0 && Distance % 64 == 0, "zcrc::streaming's distance must be a whole number of cache lines");
+    explicit streaming_t() = default;
+};
+
+ZCRC_EXPORT template <typename A, std::size_t TaskSize, std::size_t Distance>
+struct streaming_t<parallel_t<A, TaskSize>, Distance> : detail::algorithm_base {
+    static_assert(sizeof(A) == 0, "zcrc::streaming goes inside zcrc::parallel, not around it");
+};
+
+// The fastest kernel the target has for the CRC at hand: dedicated CRC instructions
+// where they compute it (SSE4.2 and ARMv8's CRC32 extension), carry-less multiplication
+// (PCLMULQDQ, PMULL, Zbc) for any other CRC up to 64 bits wide, byte shuffles (WebAssembly
+// SIMD128) for long messages with 8-, 16-, or 32-bit CRCs, and slice_by<8> otherwise.
+ZCRC_EXPORT struct native_t : detail::algorithm_base {
+    explicit native_t() = default;
+};
+
 ZCRC_EXPORT template <std::size_t N>
 inline constexpr slice_by_t<N> slice_by {};
 
+ZCRC_EXPORT inline constexpr native_t native {};
+
+ZCRC_EXPORT template <algorithm auto A, std::size_t TaskSize = 0>
+inline constexpr parallel_t<decltype(A), TaskSize> parallel {};
+
 ZCRC_EXPORT template <algorithm auto A>
-inline constexpr parallel_t<decltype(A)> parallel {};
+inline constexpr numa_parallel_t<decltype(A)> numa_parallel {};
+
+ZCRC_EXPORT template <algorithm auto A, std::size_t Distance = 4096>
+inline constexpr streaming_t<decltype(A), Distance> streaming {};
 
-ZCRC_EXPORT inline constexpr slice_by_t<8> default_algorithm {};
+ZCRC_EXPORT inline constexpr native_t default_algorithm {};
 
 namespace detail {
 
 template <typename T>
 concept byte_like = std::is_trivially_copyable_v<T> && sizeof(T) == 1 && !std::same_as<std::remove_cv_t<T>, bool>;
 
+template <typename R>
+concept byte_buffer =
+    std::ranges::contiguous_range<R> && std::ranges::sized_range<R> && detail::byte_like<std::ranges::range_value_t<R>>;
+
 template <typename T>
 [[nodiscard]] constexpr bool bit_is_set(const T n, const std::size_t b) noexcept {
     return (n & (T{1} << b)) != T{};
@@ -205,6 +330,42 @@ template <typename T>
     return detail::rshift(std::numeric_limits<T>::max(), std::numeric_limits<T>::digits - width);
 }
 
+// Reads the little-endian T starting at [it].
+template <std::unsigned_integral T, std::random_access_iterator I>
+[[nodiscard]] constexpr T load_le(const I it) noexcept {
+    T r {0};
+    for (std::size_t i {0}; i < sizeof(T); ++i) {
+        r |= static_cast<T>(static_cast<std::uint8_t>(it[static_cast<std::iter_difference_t<I>>(i)])) << (8 * i);
+    }
+    return r;
+}
+
+// Reads the big-endian T starting at [it].
+template <std::unsigned_integral T, std::random_access_iterator I>
+[[nodiscard]] constexpr T load_be(const I it) noexcept {
+    T r {0};
+    for (std::size_t i {0}; i < sizeof(T); ++i) {
+        r = static_cast<T>((r << 8) | static_cast<std::uint8_t>(it[static_cast<std::iter_difference_t<I>>(i)]));
+    }
+    return r;
+}
+
+// std::byteswap is C++23. Compilers recognize this as a single instruction.
+[[nodiscard]] constexpr std::uint64_t byteswap(std::uint64_t n) noexcept {
+    n = ((n & 0x00FF00FF00FF00FF) << 8) | ((n >> 8) & 0x00FF00FF00FF00FF);
+    n = ((n & 0x0000FFFF0000FFFF) << 16) | ((n >> 16) & 0x0000FFFF0000FFFF);
+    return (n << 32) | (n >> 32);
+}
+
+// load_le and load_be, for when the compiler won't see through them, as it often
+// doesn't: at runtime, we can use memcpy.
+template <std::endian E>
+[[nodiscard]] inline std::uint64_t load_u64(const char * const it) noexcept {
+    std::uint64_t r; // NOLINT(cppcoreguidelines-init-variables)
+    std::memcpy(&r, it, sizeof(r));
+    return (E == std::endian::native) ? r : detail::byteswap(r);
+}
+
 // clang-format off
 template <std::size_t Bits>
 using least_uint =
@@ -284,6 +445,14 @@ process_zero_bytes_fn_impl(detail::least_uint<Width> state, const N n) noexcept
     }
 }
 
+// x^8n mod P, so that processing n zero bytes becomes a single clmul_over_field.
+// Expects the normalized Width and Poly (see process_fn).
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] constexpr least_uint<Width> x8n_mod_p(const std::uint64_t n) noexcept {
+    return detail::process_zero_bytes_fn_impl<Width, Poly, RefIn>(
+        RefIn ? least_uint<Width> {1} << (Width - 1) : least_uint<Width> {1}, n);
+}
+
 struct process_zero_bytes_fn {
     // Precondition: n >= 0
     template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut, std::integral N>
@@ -294,6 +463,60 @@ struct process_zero_bytes_fn {
     }
 };
 
+template <typename T>
+inline constexpr bool is_crc {false};
+
+template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut>
+inline constexpr bool is_crc<crc<Width, Poly, Init, RefIn, RefOut, XOROut>> {true};
+
+// A (state, length in bytes) pair, like std::pair<zcrc::crc32c, std::uint64_t>.
+template <typename T>
+concept crc_part = requires { std::tuple_size<T>::value; } && std::tuple_size_v<T> == 2 &&
+    detail::is_crc<std::remove_cv_t<std::tuple_element_t<0, T>>> &&
+    std::integral<std::remove_cv_t<std::tuple_element_t<1, T>>>;
+
+// A (buffer, length in bits) pair, like std::pair<std::span<const std::byte>, std::size_t>.
+template <typename T>
+concept bit_frame = requires { std::tuple_size<T>::value; } && std::tuple_size_v<T> == 2 &&
+    detail::byte_buffer<const std::tuple_element_t<0, T>&> &&
+    std::integral<std::remove_cv_t<std::tuple_element_t<1, T>>>;
+
+// An (offset, length) pair, like std::pair<std::size_t, std::size_t>.
+template <typename T>
+concept byte_extent = requires { std::tuple_size<T>::value; } && std::tuple_size_v<T> == 2 &&
+    std::integral<std::remove_cv_t<std::tuple_element_t<0, T>>> &&
+    std::integral<std::remove_cv_t<std::tuple_element_t<1, T>>>;
+
+struct compose_fn {
+    // Returns the state after processing the concatenation of [parts], given only
+    // each part's state and length.
+    template <std::ranges::input_range R>
+    requires detail::crc_part<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::remove_cv_t<std::tuple_element_t<0, std::ranges::range_value_t<R>>>
+    operator()(R&& parts) ZCRC_CONST_CALL_OPERATOR noexcept {
+        using crc_t = std::remove_cv_t<std::tuple_element_t<0, std::ranges::range_value_t<R>>>;
+        constexpr std::size_t w {crc_t::width < 8 ? 8 : crc_t::width};
+        constexpr typename crc_t::crc_type p {crc_t::width < 8 ? crc_t::poly << (8 - crc_t::width) : crc_t::poly};
+
+        // Parts tend to share a length (all but the last, usually), so we cache the
+        // multiplier for the previous one.
+        std::uint64_t shift_len {0};
+        typename crc_t::crc_type shift {detail::x8n_mod_p<w, p, crc_t::refin>(0)};
+
+        crc_t whole {};
+        for (auto&& part : parts) {
+            const auto len {static_cast<std::uint64_t>(std::get<1>(part))};
+            if (len != shift_len) {
+                shift_len = len;
+                shift = detail::x8n_mod_p<w, p, crc_t::refin>(len);
+            }
+            // See combine_chunked.
+            whole.m_crc = detail::clmul_over_field<w, p, crc_t::refin>(whole.m_crc ^ crc_t {}.m_crc, shift) ^ std::get<0>(part).m_crc;
+        }
+        return whole;
+    }
+};
+
 template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t SliceCount>
 inline constexpr auto tables {[]<std::size_t... Slices>(std::index_sequence<Slices...>){
     least_uint<Width> r {RefIn ? 1 : (1ULL << (Width - 1))};
@@ -331,20 +554,55 @@ template <std::size_t I>
     }
 }
 
+// Fold the sizeof...(B) bytes starting at [it] into [crc] using the last sizeof...(B)
+// of the N slice-by-N tables. The bits above Width are left as garbage.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t N, std::size_t... B, typename I>
+[[nodiscard]] constexpr least_uint<Width> slice(const least_uint<Width> crc, I& it, std::index_sequence<B...>) {
+    ZCRC_STATIC23 constexpr auto& t {detail::tables<Width, Poly, RefIn, N>};
+    if constexpr (RefIn) {
+        return (std::get<sizeof...(B) - B - 1>(t)[
+                (detail::rshift(crc, 8 * B) & 0xFF) ^ static_cast<std::uint8_t>(detail::index<B>(it))]
+            ^ ... ^ detail::rshift(crc, sizeof...(B) * 8));
+    } else {
+        return (std::get<sizeof...(B) - B - 1>(t)[
+                (detail::rshift(crc, Width - 8 * (static_cast<std::int64_t>(B) + 1)) & 0xFF) ^
+                static_cast<std::uint8_t>(detail::index<B>(it))]
+            ^ ... ^ detail::lshift(crc, sizeof...(B) * 8));
+    }
+}
+
+// The main loop of slice-by-8 over contiguous memory, but loading each 8 bytes at once,
+// in the order the CRC consumes them, instead of byte by byte. That's native order for
+// non-reflected CRCs on big-endian hosts; for reflected ones, it's a byte-reversed load,
+// which POWER and z/Architecture also have. Returns the end of what it processed.
+//
+// Only worth it on big-endian hosts: on x86-64, compilers already turn the byte loads
+// into memory operands, and this measured 10-20% slower.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] inline const char * slice_words(least_uint<Width>& crc, const char * it, const char * const end) noexcept {
+    static_assert(Width <= 64);
+    ZCRC_STATIC23 constexpr auto& t {detail::tables<Width, Poly, RefIn, 8>};
+    for (; end - it >= 8; it += 8) {
+        const std::uint64_t w {detail::load_u64<RefIn ? std::endian::little : std::endian::big>(it) ^
+            (RefIn ? std::uint64_t {crc} : std::uint64_t {crc} << (64 - Width))};
+        crc = [&]<std::size_t... B>(std::index_sequence<B...>) {
+            return static_cast<least_uint<Width>>((std::get<8 - B - 1>(t)[(RefIn ? w >> (8 * B) : w >> (56 - (8 * B))) & 0xFF] ^ ...));
+        }(std::make_index_sequence<8>{});
+    }
+    return it;
+}
+
 template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t N, typename I, typename S>
 [[nodiscard]] constexpr least_uint<Width> process_fn_impl(slice_by_t<N>, least_uint<Width> crc, I it, S end) noexcept {
-    const auto fold {[&]<std::size_t... B>(std::index_sequence<B...>) {
-        ZCRC_STATIC23 constexpr auto& t {detail::tables<Width, Poly, RefIn, N>};
-        if constexpr (RefIn) {
-            crc = (std::get<sizeof...(B) - B - 1>(t)[
-                    (detail::rshift(crc, 8 * B) & 0xFF) ^ static_cast<std::uint8_t>(detail::index<B>(it))]
-                ^ ... ^ detail::rshift(crc, sizeof...(B) * 8));
-        } else {
-            crc = (std::get<sizeof...(B) - B - 1>(t)[
-                    (detail::rshift(crc, Width - 8 * (static_cast<std::int64_t>(B) + 1)) & 0xFF) ^
-                    static_cast<std::uint8_t>(detail::index<B>(it))]
-                ^ ... ^ detail::lshift(crc, sizeof...(B) * 8));
+    if constexpr (std::endian::native == std::endian::big && N == 8 && Width <= 64 &&
+                  std::same_as<I, const char *> && std::same_as<S, const char *>) {
+        if (!std::is_constant_evaluated()) {
+            it = detail::slice_words<Width, Poly, RefIn>(crc, it, end);
         }
+    }
+
+    const auto fold {[&]<std::size_t... B>(const std::index_sequence<B...> b) {
+        crc = detail::slice<Width, Poly, RefIn, N>(crc, it, b);
     }};
 
     if constexpr (std::random_access_iterator<I>) {
@@ -388,383 +646,3567 @@ template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t N,
     }
 }
 
-template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, typename I, typename S>
-[[nodiscard]] inline detail::least_uint<Width>
-process_fn_impl(parallel_t<A>, const least_uint<Width> state, I it, S end) noexcept {
-#if !defined(__cpp_lib_parallel_algorithm) || __cpp_lib_parallel_algorithm < 201603L
-    return detail::process_fn_impl<Width, Poly, RefIn>(A {}, state, std::move(it), std::move(end));
-#else
-    if constexpr (!std::sized_sentinel_for<S, I> || !std::random_access_iterator<I>) {
-        return detail::process_fn_impl<Width, Poly, RefIn>(A {}, state, std::move(it), std::move(end));
-    } else {
-        const auto len {end - it};
-        const unsigned int hardware_threads {std::jthread::hardware_concurrency()};
-        const auto chunk_length {len / static_cast<std::iter_difference_t<I>>(hardware_threads)};
-        const auto indices {std::views::iota(0U, hardware_threads)};
-        return std::transform_reduce(
-            std::execution::par,
-            std::ranges::begin(indices),
-            std::ranges::end(indices),
-            detail::least_uint<Width>{},
-            [] (const least_uint<Width> lhs, const least_uint<Width> rhs) noexcept { return lhs ^ rhs; },
-            [&] (const unsigned int i_) noexcept {
-                const auto i {static_cast<std::iter_difference_t<I>>(i_)};
-                const auto chunk_begin {(i == 0) ? it : (it + (len % chunk_length) + (i * chunk_length))};
-                const auto chunk_end {it + (len % chunk_length) + ((i + 1) * chunk_length)};
-                return detail::process_zero_bytes_fn_impl<Width, Poly, RefIn>(
-                    detail::process_fn_impl<Width, Poly, RefIn>(
-                        A {},
-                        (i == 0) ? state : 0,
-                        chunk_begin,
-                        chunk_end
-                    ),
-                    end - chunk_end
-                );
-            });
-    }
-#endif
+// ────────── Hardware kernels ──────────
+//
+// These are only ever handed const char * ranges (see process_fn), and must give the
+// same result as slice_by for every CRC they accept, Width and Poly being normalized.
+
+#if defined(ZCRC_CRC32_KERNELS) || defined(ZCRC_CLMUL_KERNELS)
+struct clmul_result {
+    std::uint64_t lo;
+    std::uint64_t hi;
+};
+
+#if defined(ZCRC_X86_64_KERNELS)
+[[nodiscard]] inline bool has_clmul() noexcept {
+    static const bool has {__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")};
+    return has;
 }
 
-struct process_fn {
-    // Consider a user program that computes CRCs over several different types:
-    //
-    //    zcrc::crc32c::compute(std::span<char>)
-    //    zcrc::crc32c::compute(std::span<unsigned char>)
-    //    zcrc::crc32c::compute(std::span<char8_t>)
-    //
-    // These calls all do the exact same thing, but each is a separate template
-    // instantiation, so the compiler cannot deduplicate them in the final binary.
-    // To achieve that, those calls must type-erase their input to const char * and
-    // delegate to another function. But wait! We can't do that cast at compile time!
-    // So we need to *conditionally* do that type erasure.
-    //
-    // This is a mess, but it's what we need to do to provide a zero-overhead abstraction.
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
-              std::contiguous_iterator I, std::sized_sentinel_for<I> S>
-    requires detail::byte_like<std::iter_value_t<I>>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
-    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I it, S end) ZCRC_CONST_CALL_OPERATOR
-        ZCRC_RETURNS(std::is_constant_evaluated()
-            ? detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
-                slice_by<1>, crc.m_crc,
-                std::to_address(it),
-                std::to_address(it) + (end - it))
-            : detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
-                algo, crc.m_crc,
-                reinterpret_cast<const char *>(std::to_address(it)),
-                reinterpret_cast<const char *>(std::to_address(it)) + (end - it))
-        )
+[[nodiscard]] inline bool has_crc32_instructions() noexcept {
+    static const bool has {__builtin_cpu_supports("sse4.2") != 0};
+    return has;
+}
 
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
-              std::input_iterator I, std::sentinel_for<I> S>
-    requires detail::byte_like<std::iter_value_t<I>>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
-    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I it, S end) ZCRC_CONST_CALL_OPERATOR
-        ZCRC_RETURNS(std::is_constant_evaluated()
-            ? detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
-                slice_by<1>, crc.m_crc, std::move(it), std::move(end))
-            : detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
-                algo, crc.m_crc, std::move(it), std::move(end)))
+// The 127-bit carry-less product of [a] and [b].
+[[nodiscard]] ZCRC_CLMUL_TARGET inline clmul_result clmul(const std::uint64_t a, const std::uint64_t b) noexcept {
+    const __m128i r {_mm_clmulepi64_si128(
+        _mm_cvtsi64_si128(static_cast<long long>(a)), _mm_cvtsi64_si128(static_cast<long long>(b)), 0x00)};
+    return {static_cast<std::uint64_t>(_mm_cvtsi128_si64(r)), static_cast<std::uint64_t>(_mm_extract_epi64(r, 1))};
+}
+#elif defined(ZCRC_AARCH64_PMULL_KERNELS)
+[[nodiscard]] constexpr bool has_clmul() noexcept {
+    return true;
+}
 
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
-              std::ranges::input_range R>
-    requires detail::byte_like<std::ranges::range_value_t<R>>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
-    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r) ZCRC_CONST_CALL_OPERATOR
-        ZCRC_RETURNS(process_fn::operator()(algo, crc, std::ranges::begin(r), std::ranges::end(r)))
+[[nodiscard]] inline clmul_result clmul(const std::uint64_t a, const std::uint64_t b) noexcept {
+    const uint64x2_t r {vreinterpretq_u64_p128(vmull_p64(a, b))};
+    return {vgetq_lane_u64(r, 0), vgetq_lane_u64(r, 1)};
+}
+#elif defined(ZCRC_RISCV_ZBC_KERNELS)
+[[nodiscard]] constexpr bool has_clmul() noexcept {
+    return true;
+}
 
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
-              std::input_iterator I, std::sentinel_for<I> S>
-    requires detail::byte_like<std::iter_value_t<I>>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
-    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I begin, S end) ZCRC_CONST_CALL_OPERATOR
-        ZCRC_RETURNS(process_fn::operator()(default_algorithm, crc, std::move(begin), std::move(end)))
+// Zbc has no intrinsics in the compilers we support (they arrived in GCC 14 and
+// Clang 17), but it's just two instructions.
+[[nodiscard]] inline clmul_result clmul(const std::uint64_t a, const std::uint64_t b) noexcept {
+    clmul_result r; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    asm("clmul %0, %1, %2" : "=r"(r.lo) : "r"(a), "r"(b));
+    asm("clmulh %0, %1, %2" : "=r"(r.hi) : "r"(a), "r"(b));
+    return r;
+}
+#elif defined(ZCRC_POWER8_KERNELS)
+[[nodiscard]] constexpr bool has_clmul() noexcept {
+    return true;
+}
 
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
-              std::ranges::input_range R>
-    requires detail::byte_like<std::ranges::range_value_t<R>>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
-    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r) ZCRC_CONST_CALL_OPERATOR
-        ZCRC_RETURNS(process_fn::operator()(crc, std::ranges::begin(r), std::ranges::end(r)))
-};
+// vpmsumd multiplies both doublewords and XORs the products, so we zero one of them.
+// We use the compilers' vector types directly: <altivec.h> defines bool as a macro.
+using power8_u64x2 = __vector unsigned long long;
 
-struct finalize_fn {
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr least_uint<Width>
-    operator()(crc<Width, Poly, Init, RefIn, RefOut, XOROut> state) ZCRC_CONST_CALL_OPERATOR noexcept {
-        if constexpr (Width < 8 && !RefIn) {
-            state.m_crc >>= 8 - Width;
-        }
+// Element 0 is the most significant doubleword in big-endian mode, the least in little-endian mode.
+inline constexpr std::size_t power8_lane_0 {std::endian::native == std::endian::big ? 1 : 0};
 
-        if constexpr (RefIn != RefOut) {
-            state.m_crc = detail::reflect(state.m_crc, Width);
-        }
+[[nodiscard]] inline clmul_result clmul(const std::uint64_t a, const std::uint64_t b) noexcept {
+    const power8_u64x2 r {__builtin_crypto_vpmsumd(power8_u64x2 {a, 0}, power8_u64x2 {b, 0})};
+    return {r[power8_lane_0], r[1 - power8_lane_0]};
+}
+#endif
 
-        return state.m_crc ^ XOROut;
+// x^e mod P as the kernels multiply by it: as is, or for reflected CRCs,
+// bit-reversed across 64 bits and divided by x, since the carry-less product of
+// two bit-reversed numbers comes out bit-reversed across 127 bits, not 128.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] constexpr std::uint64_t clmul_constant(const std::size_t e) noexcept {
+    std::uint64_t r {1};
+    for (std::size_t i {0}; i < (RefIn ? e - 1 : e); ++i) {
+        r = ((r << 1) & detail::bottom_n_mask<std::uint64_t>(Width)) ^ (detail::bit_is_set(r, Width - 1) ? Poly : 0);
     }
+    return RefIn ? detail::reflect(r, 64) : r;
+}
+
+#if defined(ZCRC_AARCH64_CRC32_KERNELS)
+[[nodiscard]] constexpr bool has_crc32_instructions() noexcept {
+    return true;
+}
+#endif
+
+// Which CRC each CRC32 instruction computes: x86 only has CRC32C, AArch64 also has
+// CRC-32/ISO-HDLC. Both process bytes reflected, from the same state we keep.
+enum class crc32_instruction { none, crc32c, crc32_iso_hdlc };
+
+template <std::size_t Width, auto Poly, bool RefIn>
+inline constexpr crc32_instruction crc32_instruction_for {
+#if defined(ZCRC_CRC32_KERNELS)
+    (Width == 32 && RefIn && Poly == 0x1EDC6F41) ? crc32_instruction::crc32c :
+#endif
+#if defined(ZCRC_AARCH64_CRC32_KERNELS)
+    (Width == 32 && RefIn && Poly == 0x04C11DB7) ? crc32_instruction::crc32_iso_hdlc :
+#endif
+    crc32_instruction::none
 };
 
-struct is_valid_fn {
-    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut>
-    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
-    operator()(crc<Width, Poly, Init, RefIn, RefOut, XOROut> state) ZCRC_CONST_CALL_OPERATOR noexcept {
-        ZCRC_STATIC23 constexpr least_uint<Width> residue {[] {
-            least_uint<Width> residue_ {XOROut};
+template <crc32_instruction C>
+[[nodiscard]] ZCRC_CRC32_TARGET inline std::uint32_t crc32_step(const std::uint32_t crc, const std::uint64_t bytes) noexcept {
+#if defined(ZCRC_X86_64_KERNELS)
+    return static_cast<std::uint32_t>(_mm_crc32_u64(crc, bytes));
+#elif defined(ZCRC_AARCH64_CRC32_KERNELS)
+    return (C == crc32_instruction::crc32c) ? __crc32cd(crc, bytes) : __crc32d(crc, bytes);
+#else
+    static_assert(C != C, "no CRC32 instructions on this target");
+    return crc ^ static_cast<std::uint32_t>(bytes);
+#endif
+}
 
-            for (std::size_t i {0}; i < Width; ++i) {
-                residue_ = (residue_ << 1) ^ (detail::bit_is_set(residue_, Width - 1) ? Poly : 0);
-            }
+template <crc32_instruction C>
+[[nodiscard]] ZCRC_CRC32_TARGET inline std::uint32_t crc32_step(const std::uint32_t crc, const std::uint8_t byte) noexcept {
+#if defined(ZCRC_X86_64_KERNELS)
+    return _mm_crc32_u8(crc, byte);
+#elif defined(ZCRC_AARCH64_CRC32_KERNELS)
+    return (C == crc32_instruction::crc32c) ? __crc32cb(crc, byte) : __crc32b(crc, byte);
+#else
+    static_assert(C != C, "no CRC32 instructions on this target");
+    return crc ^ byte;
+#endif
+}
 
-            residue_ &= detail::bottom_n_mask<least_uint<Width>>(Width);
+// [crc] · x^(8 · N) mod P. With carry-less multiplication, that's one multiplication
+// and one CRC32 instruction (crc32(0, v) is v · x^32 mod P, but v, holding a product
+// of reflected numbers, sits one bit off, so the constant is x^(8 · N - 33) mod P).
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::ptrdiff_t N>
+[[nodiscard]] ZCRC_CRC32_TARGET std::uint32_t crc32_shift(const std::uint32_t crc) noexcept {
+#if defined(ZCRC_CLMUL_KERNELS)
+    if (detail::has_clmul()) {
+        constexpr std::uint64_t k {detail::clmul_constant<32, Poly, true>((8 * N) - 32) >> 32};
+        return detail::crc32_step<detail::crc32_instruction_for<Width, Poly, RefIn>>(0, detail::clmul(crc, k).lo);
+    }
+#endif
+    return detail::clmul_over_field<32, Poly, true>(crc, detail::x8n_mod_p<32, Poly, true>(N));
+}
 
-            if constexpr (RefIn) {
-                return detail::reflect(residue_, Width);
-            } else if constexpr (Width < 8) {
-                return residue_ << (8 - Width);
-            } else {
-                return residue_;
-            }
-        }()};
+// The CRC32 instructions take 3 cycles, but a new one can start every cycle, so we run
+// three streams over consecutive thirds of each block and stitch them together after
+// (see combine_chunked; the streams after the first start from zero, so there's no
+// initial value to cancel).
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] ZCRC_CRC32_TARGET std::uint32_t crc32_fn_impl(std::uint32_t crc, const char * it, const char * const end) noexcept {
+    constexpr crc32_instruction c {detail::crc32_instruction_for<Width, Poly, RefIn>};
+    constexpr std::ptrdiff_t stride {1024};
 
-        return state.m_crc == residue;
+    for (; end - it >= 3 * stride; it += 3 * stride) {
+        std::uint32_t crc_1 {0};
+        std::uint32_t crc_2 {0};
+        for (std::ptrdiff_t i {0}; i < stride; i += 8) {
+            crc = detail::crc32_step<c>(crc, detail::load_u64<std::endian::little>(it + i));
+            crc_1 = detail::crc32_step<c>(crc_1, detail::load_u64<std::endian::little>(it + stride + i));
+            crc_2 = detail::crc32_step<c>(crc_2, detail::load_u64<std::endian::little>(it + (2 * stride) + i));
+        }
+        crc = detail::crc32_shift<Width, Poly, RefIn, 2 * stride>(crc) ^
+              detail::crc32_shift<Width, Poly, RefIn, stride>(crc_1) ^ crc_2;
     }
-};
+    for (; end - it >= 8; it += 8) {
+        crc = detail::crc32_step<c>(crc, detail::load_u64<std::endian::little>(it));
+    }
+    for (; it != end; ++it) {
+        crc = detail::crc32_step<c>(crc, static_cast<std::uint8_t>(*it));
+    }
+    return crc;
+}
 
-} // namespace detail
+// A 16-byte block of the message, as a polynomial of degree < 128 held in a vector
+// register, x^127 to x^64 being its high half and x^63 to x^0 its low one. For
+// reflected CRCs, each half is bit-reversed (bit i holds the coefficient of x^(63 - i)
+// within the half) and the high half goes in lane 0, so a block is just a load; for
+// the rest, the whole block is byte-swapped.
+#if defined(ZCRC_X86_64_KERNELS)
+using clmul_block = __m128i;
 
-ZCRC_EXPORT inline constexpr detail::combine_fn combine {};
-ZCRC_EXPORT inline constexpr detail::process_zero_bytes_fn process_zero_bytes {};
-ZCRC_EXPORT inline constexpr detail::process_fn process {};
-ZCRC_EXPORT inline constexpr detail::finalize_fn finalize {};
-ZCRC_EXPORT inline constexpr detail::is_valid_fn is_valid {};
+template <bool RefIn>
+[[nodiscard]] ZCRC_CLMUL_TARGET inline clmul_block clmul_make(const std::uint64_t high, const std::uint64_t low) noexcept {
+    return RefIn
+        ? _mm_set_epi64x(static_cast<long long>(low), static_cast<long long>(high))
+        : _mm_set_epi64x(static_cast<long long>(high), static_cast<long long>(low));
+}
 
-ZCRC_EXPORT struct zero_init_t {
-    explicit zero_init_t() = default;
-};
+template <bool RefIn>
+[[nodiscard]] ZCRC_CLMUL_TARGET inline clmul_block clmul_load(const char * const it) noexcept {
+    const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i *>(it))};
+    return RefIn ? b : _mm_shuffle_epi8(b, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
 
-ZCRC_EXPORT inline constexpr zero_init_t zero_init {};
+template <bool RefIn>
+ZCRC_CLMUL_TARGET inline void clmul_store(const clmul_block b, char * const out) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+        RefIn ? b : _mm_shuffle_epi8(b, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+}
 
-template <
-    std::size_t Width,
-    detail::least_uint<Width> Poly,
-    detail::least_uint<Width> Init,
-    bool RefIn,
-    bool RefOut,
-    detail::least_uint<Width> XOROut
->
-class crc {
-public:
-    using crc_type = detail::least_uint<Width>;
+[[nodiscard]] ZCRC_CLMUL_TARGET inline clmul_block clmul_xor(const clmul_block a, const clmul_block b) noexcept {
+    return _mm_xor_si128(a, b);
+}
 
-private:
-    crc_type m_crc {[] () noexcept {
-        if constexpr (RefIn) {
-            return detail::reflect(Init, Width);
-        } else if constexpr (Width < 8) {
-            return Init << (8 - Width);
-        } else {
-            return Init;
-        }
-    }()};
+// Returns [b] · x^e + [next], where [k] = clmul_make(x^(e + 64), x^e) mod P. Either
+// way, each half of [b] is multiplied by the constant in the same lane.
+[[nodiscard]] ZCRC_CLMUL_TARGET inline clmul_block clmul_fold(const clmul_block b, const clmul_block k, const clmul_block next) noexcept {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(b, k, 0x00), _mm_clmulepi64_si128(b, k, 0x11)), next);
+}
+#elif defined(ZCRC_AARCH64_PMULL_KERNELS)
+using clmul_block = uint64x2_t;
 
-    [[nodiscard]] constexpr crc(const crc_type crc) noexcept : m_crc {crc} {}
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_make(const std::uint64_t high, const std::uint64_t low) noexcept {
+    return RefIn
+        ? vcombine_u64(vcreate_u64(high), vcreate_u64(low))
+        : vcombine_u64(vcreate_u64(low), vcreate_u64(high));
+}
 
-    friend struct detail::combine_fn;
-    friend struct detail::process_zero_bytes_fn;
-    friend struct detail::process_fn;
-    friend struct detail::finalize_fn;
-    friend struct detail::is_valid_fn;
+[[nodiscard]] inline uint8x16_t clmul_byteswap(const uint8x16_t b) noexcept {
+    const uint8x16_t r {vrev64q_u8(b)};
+    return vextq_u8(r, r, 8);
+}
 
-    struct compute_member_fn {
-        template <std::input_iterator I, std::sentinel_for<I> S>
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_load(const char * const it) noexcept {
+    const uint8x16_t b {vld1q_u8(reinterpret_cast<const std::uint8_t *>(it))};
+    return vreinterpretq_u64_u8(RefIn ? b : detail::clmul_byteswap(b));
+}
+
+template <bool RefIn>
+inline void clmul_store(const clmul_block b, char * const out) noexcept {
+    const uint8x16_t bytes {vreinterpretq_u8_u64(b)};
+    vst1q_u8(reinterpret_cast<std::uint8_t *>(out), RefIn ? bytes : detail::clmul_byteswap(bytes));
+}
+
+[[nodiscard]] inline clmul_block clmul_xor(const clmul_block a, const clmul_block b) noexcept {
+    return veorq_u64(a, b);
+}
+
+// Returns [b] · x^e + [next], where [k] = clmul_make(x^(e + 64), x^e) mod P. Either
+// way, each half of [b] is multiplied by the constant in the same lane.
+[[nodiscard]] inline clmul_block clmul_fold(const clmul_block b, const clmul_block k, const clmul_block next) noexcept {
+    const uint64x2_t l {vreinterpretq_u64_p128(vmull_p64(vgetq_lane_u64(b, 0), vgetq_lane_u64(k, 0)))};
+    const uint64x2_t h {vreinterpretq_u64_p128(vmull_high_p64(vreinterpretq_p64_u64(b), vreinterpretq_p64_u64(k)))};
+    return veorq_u64(veorq_u64(l, h), next);
+}
+#elif defined(ZCRC_POWER8_KERNELS)
+using clmul_block = power8_u64x2;
+
+[[nodiscard]] inline clmul_block power8_lanes(const std::uint64_t lane_0, const std::uint64_t lane_1) noexcept {
+    return (power8_lane_0 == 0) ? clmul_block {lane_0, lane_1} : clmul_block {lane_1, lane_0};
+}
+
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_make(const std::uint64_t high, const std::uint64_t low) noexcept {
+    return RefIn ? detail::power8_lanes(high, low) : detail::power8_lanes(low, high);
+}
+
+// Two doubleword loads, which the compiler can do byte-reversed where needed (ldbrx).
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_load(const char * const it) noexcept {
+    return RefIn
+        ? detail::power8_lanes(detail::load_u64<std::endian::little>(it), detail::load_u64<std::endian::little>(it + 8))
+        : detail::power8_lanes(detail::load_u64<std::endian::big>(it + 8), detail::load_u64<std::endian::big>(it));
+}
+
+template <bool RefIn>
+inline void clmul_store(const clmul_block b, char * const out) noexcept {
+    const std::uint64_t lane_0 {b[power8_lane_0]};
+    const std::uint64_t lane_1 {b[1 - power8_lane_0]};
+    for (std::size_t i {0}; i < 8; ++i) {
+        if constexpr (RefIn) {
+            out[i] = static_cast<char>(lane_0 >> (8 * i));
+            out[i + 8] = static_cast<char>(lane_1 >> (8 * i));
+        } else {
+            out[i] = static_cast<char>(lane_1 >> (56 - (8 * i)));
+            out[i + 8] = static_cast<char>(lane_0 >> (56 - (8 * i)));
+        }
+    }
+}
+
+[[nodiscard]] inline clmul_block clmul_xor(const clmul_block a, const clmul_block b) noexcept {
+    return a ^ b;
+}
+
+// Returns [b] · x^e + [next], where [k] = clmul_make(x^(e + 64), x^e) mod P. vpmsumd
+// pairs up the lanes exactly as we need, XOR and all.
+[[nodiscard]] inline clmul_block clmul_fold(const clmul_block b, const clmul_block k, const clmul_block next) noexcept {
+    return __builtin_crypto_vpmsumd(b, k) ^ next;
+}
+#elif defined(ZCRC_CLMUL_KERNELS)
+// Without vector registers, a block is a pair of lanes, laid out as above.
+struct clmul_block {
+    std::uint64_t lane_0;
+    std::uint64_t lane_1;
+};
+
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_make(const std::uint64_t high, const std::uint64_t low) noexcept {
+    return RefIn ? clmul_block {high, low} : clmul_block {low, high};
+}
+
+template <bool RefIn>
+[[nodiscard]] inline clmul_block clmul_load(const char * const it) noexcept {
+    return RefIn
+        ? clmul_block {detail::load_u64<std::endian::little>(it), detail::load_u64<std::endian::little>(it + 8)}
+        : clmul_block {detail::load_u64<std::endian::big>(it + 8), detail::load_u64<std::endian::big>(it)};
+}
+
+template <bool RefIn>
+inline void clmul_store(const clmul_block b, char * const out) noexcept {
+    for (std::size_t i {0}; i < 8; ++i) {
+        if constexpr (RefIn) {
+            out[i] = static_cast<char>(b.lane_0 >> (8 * i));
+            out[i + 8] = static_cast<char>(b.lane_1 >> (8 * i));
+        } else {
+            out[i] = static_cast<char>(b.lane_1 >> (56 - (8 * i)));
+            out[i + 8] = static_cast<char>(b.lane_0 >> (56 - (8 * i)));
+        }
+    }
+}
+
+[[nodiscard]] inline clmul_block clmul_xor(const clmul_block a, const clmul_block b) noexcept {
+    return {a.lane_0 ^ b.lane_0, a.lane_1 ^ b.lane_1};
+}
+
+// Returns [b] · x^e + [next], where [k] = clmul_make(x^(e + 64), x^e) mod P.
+[[nodiscard]] inline clmul_block clmul_fold(const clmul_block b, const clmul_block k, const clmul_block next) noexcept {
+    const clmul_result l {detail::clmul(b.lane_0, k.lane_0)};
+    const clmul_result h {detail::clmul(b.lane_1, k.lane_1)};
+    return {l.lo ^ h.lo ^ next.lane_0, l.hi ^ h.hi ^ next.lane_1};
+}
+#endif
+
+#if defined(ZCRC_CLMUL_KERNELS)
+// Folding, as in the PCLMULQDQ paper in the design notes, for any Width <= 64 (and,
+// being normalized, >= 8). Four blocks are folded 64 bytes ahead at a time to keep
+// the multiplier busy, then into each other, and then whatever 16-byte blocks remain
+// are folded in. The result is congruent to the message (with [crc] XORed into its
+// start) mod P, so processing it from zero with the tables finishes the job.
+//
+// Precondition: end - it >= 64
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] ZCRC_CLMUL_TARGET least_uint<Width> fold_fn_impl(const least_uint<Width> crc, const char * it, const char * const end) noexcept {
+    constexpr std::array<std::uint64_t, 4> k {
+        detail::clmul_constant<Width, Poly, RefIn>(128 + 64), detail::clmul_constant<Width, Poly, RefIn>(128),
+        detail::clmul_constant<Width, Poly, RefIn>(512 + 64), detail::clmul_constant<Width, Poly, RefIn>(512),
+    };
+    const clmul_block by_1 {detail::clmul_make<RefIn>(k[0], k[1])};
+    const clmul_block by_4 {detail::clmul_make<RefIn>(k[2], k[3])};
+
+    // Not std::array, which would drop the vector type's alignment attributes.
+    clmul_block acc[4]; // NOLINT(*-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+    for (std::size_t i {0}; i < std::size(acc); ++i) {
+        acc[i] = detail::clmul_load<RefIn>(it + (16 * i));
+    }
+    acc[0] = detail::clmul_xor(acc[0],
+        detail::clmul_make<RefIn>(RefIn ? std::uint64_t {crc} : std::uint64_t {crc} << (64 - Width), 0));
+    it += 64;
+
+    for (; end - it >= 64; it += 64) {
+        for (std::size_t i {0}; i < std::size(acc); ++i) {
+            acc[i] = detail::clmul_fold(acc[i], by_4, detail::clmul_load<RefIn>(it + (16 * i)));
+        }
+    }
+    clmul_block folded {acc[0]};
+    for (std::size_t i {1}; i < std::size(acc); ++i) {
+        folded = detail::clmul_fold(folded, by_1, acc[i]);
+    }
+    for (; end - it >= 16; it += 16) {
+        folded = detail::clmul_fold(folded, by_1, detail::clmul_load<RefIn>(it));
+    }
+
+    std::array<char, 16> bytes; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    detail::clmul_store<RefIn>(folded, bytes.data());
+    const least_uint<Width> reduced {detail::process_fn_impl<Width, Poly, RefIn>(
+        slice_by<8>, least_uint<Width> {0}, bytes.data(), bytes.data() + bytes.size())};
+    return detail::process_fn_impl<Width, Poly, RefIn>(slice_by<8>, reduced, it, end);
+}
+#endif
+
+#endif
+
+#if defined(ZCRC_NIBBLE_KERNELS)
+// The nibble kernel runs one stream per byte lane of a vector, each keeping its state
+// as Width / 8 vectors, one per byte, in message order (so XORing in the next Width / 8
+// bytes of the stream is byte-wise). The state after absorbing them is then linear in
+// the result, so it's the XOR of one lookup per nibble per output byte, and each of
+// those is a 16-entry table: a single shuffle, with no memory traffic.
+//
+// Besides the vector operations, each backend provides nibble_table, which loads a
+// table into every group of 16 lanes, and nibble_row, which loads 16 consecutive
+// bytes of each of the lanes that will end up in one group once transposed.
+#if defined(ZCRC_AVX2_KERNELS)
+// AVX2's shuffles and interleaves never cross the 128-bit halves of a register, so
+// each half is a group of 16 lanes running exactly as it would with SSSE3.
+using nibble_vector = __m256i;
+
+[[nodiscard]] constexpr bool has_nibble_lookups() noexcept {
+    return true;
+}
+
+[[nodiscard]] inline nibble_vector nibble_load(const void * const p) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(p));
+}
+
+inline void nibble_store(const nibble_vector v, void * const p) noexcept {
+    _mm256_storeu_si256(static_cast<__m256i *>(p), v);
+}
+
+[[nodiscard]] inline nibble_vector nibble_xor(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm256_xor_si256(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_low(const nibble_vector v) noexcept {
+    return _mm256_and_si256(v, _mm256_set1_epi8(0x0F));
+}
+
+[[nodiscard]] inline nibble_vector nibble_high(const nibble_vector v) noexcept {
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+// [indices] must be < 16.
+[[nodiscard]] inline nibble_vector nibble_lookup(const nibble_vector table, const nibble_vector indices) noexcept {
+    return _mm256_shuffle_epi8(table, indices);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_low(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm256_unpacklo_epi8(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_high(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm256_unpackhi_epi8(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_table(const std::uint8_t * const table) noexcept {
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+}
+
+// Lane [i] in the low half, lane [i] + 16 in the high one.
+[[nodiscard]] inline nibble_vector nibble_row(const char * const * const its, const std::size_t i, const std::ptrdiff_t offset) noexcept {
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(its[i] + offset))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(its[i + 16] + offset)), 1);
+}
+#elif defined(ZCRC_X86_64_KERNELS)
+using nibble_vector = __m128i;
+
+[[nodiscard]] inline bool has_nibble_lookups() noexcept {
+    static const bool has {__builtin_cpu_supports("ssse3") != 0};
+    return has;
+}
+
+[[nodiscard]] inline nibble_vector nibble_load(const void * const p) noexcept {
+    return _mm_loadu_si128(static_cast<const __m128i *>(p));
+}
+
+inline void nibble_store(const nibble_vector v, void * const p) noexcept {
+    _mm_storeu_si128(static_cast<__m128i *>(p), v);
+}
+
+[[nodiscard]] inline nibble_vector nibble_xor(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm_xor_si128(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_low(const nibble_vector v) noexcept {
+    return _mm_and_si128(v, _mm_set1_epi8(0x0F));
+}
+
+[[nodiscard]] inline nibble_vector nibble_high(const nibble_vector v) noexcept {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+}
+
+// [indices] must be < 16.
+[[nodiscard]] ZCRC_NIBBLE_TARGET inline nibble_vector nibble_lookup(const nibble_vector table, const nibble_vector indices) noexcept {
+    return _mm_shuffle_epi8(table, indices);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_low(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm_unpacklo_epi8(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_high(const nibble_vector a, const nibble_vector b) noexcept {
+    return _mm_unpackhi_epi8(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_table(const std::uint8_t * const table) noexcept {
+    return detail::nibble_load(table);
+}
+
+[[nodiscard]] inline nibble_vector nibble_row(const char * const * const its, const std::size_t i, const std::ptrdiff_t offset) noexcept {
+    return detail::nibble_load(its[i] + offset);
+}
+#elif defined(ZCRC_WASM_SIMD128_KERNELS)
+using nibble_vector = v128_t;
+
+[[nodiscard]] constexpr bool has_nibble_lookups() noexcept {
+    return true;
+}
+
+[[nodiscard]] inline nibble_vector nibble_load(const void * const p) noexcept {
+    return wasm_v128_load(p);
+}
+
+inline void nibble_store(const nibble_vector v, void * const p) noexcept {
+    wasm_v128_store(p, v);
+}
+
+[[nodiscard]] inline nibble_vector nibble_xor(const nibble_vector a, const nibble_vector b) noexcept {
+    return wasm_v128_xor(a, b);
+}
+
+[[nodiscard]] inline nibble_vector nibble_low(const nibble_vector v) noexcept {
+    return wasm_v128_and(v, wasm_i8x16_splat(0x0F));
+}
+
+[[nodiscard]] inline nibble_vector nibble_high(const nibble_vector v) noexcept {
+    return wasm_u8x16_shr(v, 4);
+}
+
+// [indices] must be < 16.
+[[nodiscard]] inline nibble_vector nibble_lookup(const nibble_vector table, const nibble_vector indices) noexcept {
+    return wasm_i8x16_swizzle(table, indices);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_low(const nibble_vector a, const nibble_vector b) noexcept {
+    return wasm_i8x16_shuffle(a, b, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+}
+
+[[nodiscard]] inline nibble_vector nibble_interleave_high(const nibble_vector a, const nibble_vector b) noexcept {
+    return wasm_i8x16_shuffle(a, b, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+}
+
+[[nodiscard]] inline nibble_vector nibble_table(const std::uint8_t * const table) noexcept {
+    return detail::nibble_load(table);
+}
+
+[[nodiscard]] inline nibble_vector nibble_row(const char * const * const its, const std::size_t i, const std::ptrdiff_t offset) noexcept {
+    return detail::nibble_load(its[i] + offset);
+}
+#endif
+
+inline constexpr std::size_t nibble_lanes {sizeof(nibble_vector)};
+
+// Byte [j] of [state], counting in message order.
+template <std::size_t Width, bool RefIn>
+[[nodiscard]] constexpr std::uint8_t state_byte(const least_uint<Width> state, const std::size_t j) noexcept {
+    return static_cast<std::uint8_t>(RefIn ? state >> (8 * j) : state >> (Width - 8 - (8 * j)));
+}
+
+// [p][j][n] is byte [j] of the state left by absorbing nibble [n] at position [p]
+// (the low nibble of byte p / 2 for even p, the high one for odd).
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+inline constexpr auto nibble_tables {[] {
+    constexpr std::size_t bytes {Width / 8};
+    std::array<std::array<std::array<std::uint8_t, 16>, bytes>, 2 * bytes> tables_ {};
+    for (std::size_t p {0}; p < tables_.size(); ++p) {
+        for (std::size_t n {0}; n < 16; ++n) {
+            std::array<std::uint8_t, bytes> message {};
+            message[p / 2] = static_cast<std::uint8_t>(n << (4 * (p % 2)));
+            const least_uint<Width> state {detail::process_fn_impl<Width, Poly, RefIn>(
+                slice_by<1>, least_uint<Width> {0}, message.begin(), message.end())};
+            for (std::size_t j {0}; j < bytes; ++j) {
+                tables_[p][j][n] = detail::state_byte<Width, RefIn>(state, j);
+            }
+        }
+    }
+    return tables_;
+}()};
+
+// Every lane's state, as nibble_lanes_fn_impl keeps it: [j][lane] is byte [j] of [lane].
+template <std::size_t Width>
+using nibble_state = std::array<std::array<std::uint8_t, nibble_lanes>, Width / 8>;
+
+template <std::size_t Width, bool RefIn>
+constexpr void set_lane(nibble_state<Width>& state, const std::size_t lane, const least_uint<Width> crc) noexcept {
+    for (std::size_t j {0}; j < Width / 8; ++j) {
+        state[j][lane] = detail::state_byte<Width, RefIn>(crc, j);
+    }
+}
+
+template <std::size_t Width, bool RefIn>
+[[nodiscard]] constexpr least_uint<Width> get_lane(const nibble_state<Width>& state, const std::size_t lane) noexcept {
+    least_uint<Width> crc {0};
+    for (std::size_t j {0}; j < Width / 8; ++j) {
+        crc |= static_cast<least_uint<Width>>(
+            static_cast<least_uint<Width>>(state[j][lane]) << (RefIn ? 8 * j : Width - 8 - (8 * j)));
+    }
+    return crc;
+}
+
+// Turn rows of 16 bytes into columns; doing the same perfect shuffle four times
+// moves each byte's row index into its column index and vice versa.
+ZCRC_NIBBLE_TARGET inline void nibble_transpose(nibble_vector (&rows)[16]) noexcept { // NOLINT(*-avoid-c-arrays)
+#pragma GCC unroll 4
+    for (std::size_t round {0}; round < 4; ++round) {
+        nibble_vector shuffled[16]; // NOLINT(*-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+#pragma GCC unroll 8
+        for (std::size_t i {0}; i < 8; ++i) {
+            shuffled[2 * i] = detail::nibble_interleave_low(rows[i], rows[i + 8]);
+            shuffled[(2 * i) + 1] = detail::nibble_interleave_high(rows[i], rows[i + 8]);
+        }
+        std::copy(std::begin(shuffled), std::end(shuffled), std::begin(rows));
+    }
+}
+
+// Advance each lane of [state] over the [len] bytes starting at its element of [its].
+//
+// Precondition: Width is a multiple of 8, and len is a multiple of 16
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+ZCRC_NIBBLE_TARGET void nibble_lanes_fn_impl(
+    nibble_state<Width>& state, const std::array<const char *, nibble_lanes>& its, const std::ptrdiff_t len
+) noexcept {
+    constexpr std::size_t bytes {Width / 8};
+    ZCRC_STATIC23 constexpr auto& t {detail::nibble_tables<Width, Poly, RefIn>};
+
+    nibble_vector s[bytes]; // NOLINT(*-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+    for (std::size_t j {0}; j < bytes; ++j) {
+        s[j] = detail::nibble_load(state[j].data());
+    }
+
+    for (std::ptrdiff_t offset {0}; offset < len; offset += 16) {
+        nibble_vector rows[16]; // NOLINT(*-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+#pragma GCC unroll 16
+        for (std::size_t i {0}; i < 16; ++i) {
+            rows[i] = detail::nibble_row(its.data(), i, offset);
+        }
+        detail::nibble_transpose(rows);
+#pragma GCC unroll 16
+        for (std::size_t k {0}; k < 16; k += bytes) {
+            nibble_vector x[bytes]; // NOLINT(*-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+            for (std::size_t j {0}; j < bytes; ++j) {
+                x[j] = detail::nibble_xor(s[j], rows[k + j]);
+            }
+            for (std::size_t out {0}; out < bytes; ++out) {
+                nibble_vector r {detail::nibble_lookup(detail::nibble_table(t[0][out].data()), detail::nibble_low(x[0]))};
+                r = detail::nibble_xor(r, detail::nibble_lookup(detail::nibble_table(t[1][out].data()), detail::nibble_high(x[0])));
+                for (std::size_t j {1}; j < bytes; ++j) {
+                    r = detail::nibble_xor(r, detail::nibble_lookup(detail::nibble_table(t[2 * j][out].data()), detail::nibble_low(x[j])));
+                    r = detail::nibble_xor(r, detail::nibble_lookup(detail::nibble_table(t[(2 * j) + 1][out].data()), detail::nibble_high(x[j])));
+                }
+                s[out] = r;
+            }
+        }
+    }
+
+    for (std::size_t j {0}; j < bytes; ++j) {
+        detail::nibble_store(s[j], state[j].data());
+    }
+}
+
+// Splits the message into one chunk per lane, a multiple of 16 bytes each, and
+// stitches the lanes' CRCs together as combine_chunked does, leaving what's left over
+// for the tables.
+//
+// Precondition: Width is a multiple of 8, and end - it >= 16 * nibble_lanes
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] least_uint<Width> nibble_fn_impl(const least_uint<Width> crc, const char * it, const char * const end) noexcept {
+    const std::ptrdiff_t chunk {((end - it) / static_cast<std::ptrdiff_t>(nibble_lanes)) & ~std::ptrdiff_t {15}};
+
+    nibble_state<Width> state {};
+    detail::set_lane<Width, RefIn>(state, 0, crc);
+    std::array<const char *, nibble_lanes> its {};
+    for (std::size_t i {0}; i < nibble_lanes; ++i) {
+        its[i] = it + (static_cast<std::ptrdiff_t>(i) * chunk);
+    }
+    detail::nibble_lanes_fn_impl<Width, Poly, RefIn>(state, its, chunk);
+
+    const least_uint<Width> shift {detail::x8n_mod_p<Width, Poly, RefIn>(static_cast<std::uint64_t>(chunk))};
+    least_uint<Width> whole {0};
+    for (std::size_t i {0}; i < nibble_lanes; ++i) {
+        whole = detail::clmul_over_field<Width, Poly, RefIn>(whole, shift) ^ detail::get_lane<Width, RefIn>(state, i);
+    }
+    it += static_cast<std::ptrdiff_t>(nibble_lanes) * chunk;
+    return detail::process_fn_impl<Width, Poly, RefIn>(slice_by<8>, whole, it, end);
+}
+
+// process_batch_fn_impl with one message per lane of the nibble kernel: the lanes
+// advance together over the shortest message in the group, rounded down to 16 bytes,
+// and then each one finishes alone.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename L, typename F>
+std::size_t nibble_batch_fn_impl(const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink) {
+    std::size_t i {0};
+    for (; count - i >= nibble_lanes; i += nibble_lanes) {
+        std::array<const char *, nibble_lanes> its {};
+        std::array<std::ptrdiff_t, nibble_lanes> lens {};
+        for (std::size_t l {0}; l < nibble_lanes; ++l) {
+            std::tie(its[l], lens[l]) = locate(i + l);
+        }
+        const std::ptrdiff_t common {std::ranges::min(lens) & ~std::ptrdiff_t {15}};
+
+        nibble_state<Width> state {};
+        for (std::size_t l {0}; l < nibble_lanes; ++l) {
+            detail::set_lane<Width, RefIn>(state, l, init);
+        }
+        if (common != 0) {
+            detail::nibble_lanes_fn_impl<Width, Poly, RefIn>(state, its, common);
+        }
+
+        for (std::size_t l {0}; l < nibble_lanes; ++l) {
+            const least_uint<Width> crc {detail::process_fn_impl<Width, Poly, RefIn>(
+                slice_by<8>, detail::get_lane<Width, RefIn>(state, l), its[l] + common, its[l] + lens[l])};
+            if (!sink(i + l, crc)) {
+                return i + l;
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        const auto [it, len] {locate(i)};
+        if (!sink(i, detail::process_fn_impl<Width, Poly, RefIn>(slice_by<8>, init, it, it + len))) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// Wider CRCs need (Width / 8)^2 lookups per Width / 8 bytes, and at 64 bits, that's
+// slower than the tables.
+template <std::size_t Width>
+inline constexpr bool nibble_kernel_width {Width == 8 || Width == 16 || Width == 32};
+#endif
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] inline bool has_native_kernel() noexcept {
+#if defined(ZCRC_CRC32_KERNELS)
+    if constexpr (detail::crc32_instruction_for<Width, Poly, RefIn> != crc32_instruction::none) {
+        if (detail::has_crc32_instructions()) {
+            return true;
+        }
+    }
+#endif
+#if defined(ZCRC_CLMUL_KERNELS)
+    return Width <= 64 && detail::has_clmul();
+#else
+    return false;
+#endif
+}
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename I, typename S>
+[[nodiscard]] inline least_uint<Width> process_fn_impl(native_t, const least_uint<Width> crc, I it, S end) noexcept {
+    if constexpr (std::same_as<I, const char *> && std::same_as<S, const char *>) {
+#if defined(ZCRC_CRC32_KERNELS)
+        if constexpr (detail::crc32_instruction_for<Width, Poly, RefIn> != crc32_instruction::none) {
+            if (detail::has_crc32_instructions()) {
+                return detail::crc32_fn_impl<Width, Poly, RefIn>(crc, it, end);
+            }
+        }
+#endif
+#if defined(ZCRC_CLMUL_KERNELS)
+        if constexpr (Width <= 64) {
+            if (end - it >= 64 && detail::has_clmul()) {
+                return detail::fold_fn_impl<Width, Poly, RefIn>(crc, it, end);
+            }
+        }
+#endif
+#if defined(ZCRC_NIBBLE_KERNELS)
+        if constexpr (detail::nibble_kernel_width<Width>) {
+            // Below this, stitching the lanes together costs more than they save.
+            if (end - it >= static_cast<std::ptrdiff_t>(64 * nibble_lanes) && detail::has_nibble_lookups()) {
+                return detail::nibble_fn_impl<Width, Poly, RefIn>(crc, it, end);
+            }
+        }
+#endif
+    }
+    return detail::process_fn_impl<Width, Poly, RefIn>(slice_by<8>, crc, std::move(it), std::move(end));
+}
+
+// Hint that the cache line at [p] will be read soon, and only once. On x86, this is
+// prefetchnta, which brings the line into L1 while keeping it out of the outer levels
+// as far as the microarchitecture allows; on ARM, it's PLDL1STRM.
+inline void prefetch_once(const char * const p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 0);
+#else
+    (void)p;
+#endif
+}
+
+// Only contiguous input can be prefetched; anything else is left to A as is. A gets
+// the input a page at a time, and before each one, we ask for the page Distance
+// bytes further on.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, std::size_t Distance, typename I, typename S>
+[[nodiscard]] inline least_uint<Width> process_fn_impl(streaming_t<A, Distance>, least_uint<Width> crc, I it, S end) noexcept {
+    if constexpr (!std::same_as<I, const char *> || !std::same_as<S, const char *>) {
+        return detail::process_fn_impl<Width, Poly, RefIn>(A {}, crc, std::move(it), std::move(end));
+    } else {
+        constexpr std::ptrdiff_t block {4096};
+        constexpr auto distance {static_cast<std::ptrdiff_t>(Distance)};
+        for (std::ptrdiff_t i {0}; i < (std::min)(end - it, distance); i += 64) {
+            detail::prefetch_once(it + i);
+        }
+        for (; end - it >= distance + block; it += block) {
+            for (std::ptrdiff_t i {0}; i < block; i += 64) {
+                detail::prefetch_once(it + distance + i);
+            }
+            crc = detail::process_fn_impl<Width, Poly, RefIn>(A {}, crc, it, it + block);
+        }
+        return detail::process_fn_impl<Width, Poly, RefIn>(A {}, crc, it, end);
+    }
+}
+
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L
+// Below this many bytes a thread, handing out the work costs more than it saves.
+inline constexpr std::size_t parallel_min_chunk_length {std::size_t {1} << 14};
+
+// Splits [it, end) into tasks of [task] bytes, except the first, which also takes
+// the leftover bytes, and runs them on std::execution::par, which hands them out
+// as threads free up. Every task but the first is the same length, so one
+// precomputed x^(8 task) appends each task's result to the ones before it.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, std::random_access_iterator I>
+[[nodiscard]] inline detail::least_uint<Width>
+process_tasks_fn_impl(A, const least_uint<Width> state, const I it, const I end, const std::iter_difference_t<I> task) noexcept {
+    const auto len {end - it};
+    const auto tasks {static_cast<std::size_t>(len / task)};
+    if (tasks < 2) {
+        return detail::process_fn_impl<Width, Poly, RefIn>(A {}, state, it, end);
+    }
+    const auto head {len % task};
+    std::vector<least_uint<Width>> crcs(tasks);
+    const auto indices {std::views::iota(std::size_t {0}, tasks)};
+    std::for_each(
+        std::execution::par,
+        std::ranges::begin(indices),
+        std::ranges::end(indices),
+        [&] (const std::size_t i_) noexcept {
+            const auto i {static_cast<std::iter_difference_t<I>>(i_)};
+            crcs[i_] = detail::process_fn_impl<Width, Poly, RefIn>(
+                A {},
+                (i == 0) ? state : 0,
+                (i == 0) ? it : (it + head + (i * task)),
+                it + head + ((i + 1) * task)
+            );
+        });
+    const least_uint<Width> shift {detail::x8n_mod_p<Width, Poly, RefIn>(static_cast<std::uint64_t>(task))};
+    least_uint<Width> ret {crcs[0]};
+    for (std::size_t i {1}; i < tasks; ++i) {
+        ret = detail::clmul_over_field<Width, Poly, RefIn>(ret, shift) ^ crcs[i];
+    }
+    return ret;
+}
+#endif
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, std::size_t TaskSize, typename I, typename S>
+[[nodiscard]] inline detail::least_uint<Width>
+process_fn_impl(parallel_t<A, TaskSize>, const least_uint<Width> state, I it, S end) noexcept {
+#if !defined(__cpp_lib_parallel_algorithm) || __cpp_lib_parallel_algorithm < 201603L
+    return detail::process_fn_impl<Width, Poly, RefIn>(A {}, state, std::move(it), std::move(end));
+#else
+    if constexpr (!std::sized_sentinel_for<S, I> || !std::random_access_iterator<I>) {
+        return detail::process_fn_impl<Width, Poly, RefIn>(A {}, state, std::move(it), std::move(end));
+    } else {
+        // Without a task size, it's one task a thread (the leftover bytes join the
+        // first), but no shorter than parallel_min_chunk_length, so short messages
+        // run on this thread alone.
+        const auto len {end - it};
+        const auto hardware_threads {static_cast<std::iter_difference_t<I>>((std::max)(std::jthread::hardware_concurrency(), 1U))};
+        const auto task {(TaskSize != 0)
+            ? static_cast<std::iter_difference_t<I>>(TaskSize)
+            : (std::max)(len / hardware_threads, static_cast<std::iter_difference_t<I>>(parallel_min_chunk_length))};
+        const auto last {it + len};
+        return detail::process_tasks_fn_impl<Width, Poly, RefIn>(A {}, state, std::move(it), last, task);
+    }
+#endif
+}
+
+#if defined(ZCRC_NUMA)
+struct numa_node {
+    int id;
+    cpu_set_t cpus; // The ones we're allowed to run on.
+};
+
+// Calls [f] with each number in a sysfs list file, like "0-3,8-11".
+template <typename F>
+inline bool for_each_in_sysfs_list(const char * const path, F&& f) noexcept {
+    const int fd {::open(path, O_RDONLY | O_CLOEXEC)};
+    if (fd < 0) {
+        return false;
+    }
+    std::array<char, 4096> buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    const auto n {::read(fd, buffer.data(), buffer.size())};
+    ::close(fd);
+    if (n <= 0) {
+        return false;
+    }
+    const char * p {buffer.data()};
+    const char * const end {p + n};
+    while (p != end && *p != '\n') {
+        int first {0};
+        int last {0};
+        p = std::from_chars(p, end, first).ptr;
+        last = first;
+        if (p != end && *p == '-') {
+            p = std::from_chars(p + 1, end, last).ptr;
+        }
+        for (int i {first}; i <= last; ++i) {
+            f(i);
+        }
+        if (p != end && *p == ',') {
+            ++p;
+        } else {
+            break;
+        }
+    }
+    return true;
+}
+
+// The NUMA nodes that have CPUs we may run on, looked up once.
+[[nodiscard]] inline const std::vector<numa_node>& numa_nodes() noexcept {
+    static const std::vector<numa_node> nodes {[] {
+        std::vector<numa_node> ret;
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+            return ret;
+        }
+        (void)detail::for_each_in_sysfs_list("/sys/devices/system/node/online", [&] (const int id) {
+            std::array<char, 64> path {"/sys/devices/system/node/node"};
+            const auto prefix {std::char_traits<char>::length(path.data())};
+            const auto suffix {std::to_chars(path.data() + prefix, path.data() + path.size(), id).ptr};
+            std::memcpy(suffix, "/cpulist", sizeof("/cpulist"));
+            numa_node node {id, {}};
+            CPU_ZERO(&node.cpus);
+            (void)detail::for_each_in_sysfs_list(path.data(), [&] (const int cpu) {
+                if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+                    CPU_SET(cpu, &node.cpus);
+                }
+            });
+            if (CPU_COUNT(&node.cpus) != 0) {
+                ret.push_back(node);
+            }
+        });
+        return ret;
+    }()};
+    return nodes;
+}
+
+// Starts [f] on a new thread at the end of [pool], which must have room for it,
+// unless the system is out of threads.
+template <typename F>
+inline bool try_start_thread(std::vector<std::jthread>& pool, F&& f) noexcept {
+#if defined(__cpp_exceptions)
+    try {
+        pool.emplace_back(std::forward<F>(f));
+    } catch (const std::system_error&) {
+        return false;
+    }
+#else
+    pool.emplace_back(std::forward<F>(f));
+#endif
+    return true;
+}
+
+// The input is cut into pieces of at least 1 MiB, about four per CPU, and each
+// piece is queued on the node holding its middle page. Each node gets a thread per
+// CPU, pinned to that node, but no more threads than pieces in all; threads work
+// through their own node's queue first and then help with the others, so a skewed
+// placement still keeps every CPU busy. Pieces whose memory hasn't been touched
+// yet, or is on a node with no CPUs of ours, are dealt out round robin.
+//
+// The threads are started afresh each call rather than kept in a pool: a pool of
+// pinned threads would outlive the call with nothing to shut it down cleanly, and
+// starting a thread costs microseconds against the milliseconds each piece takes.
+// If a thread can't be started, the calling thread does its share.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, algorithm A>
+[[nodiscard]] inline least_uint<Width> numa_parallel_fn_impl(
+    const A algo, const std::vector<numa_node>& nodes, const least_uint<Width> state, const char * const it, const char * const end
+) noexcept {
+    const auto len {static_cast<std::size_t>(end - it)};
+    std::size_t cpus {0};
+    for (const auto& node : nodes) {
+        cpus += static_cast<std::size_t>(CPU_COUNT(&node.cpus));
+    }
+    const auto page_size {static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+    const std::size_t piece {((std::max)(len / (cpus * 4), std::size_t {1} << 20) + page_size - 1) / page_size * page_size};
+    const std::size_t count {(len + piece - 1) / piece};
+    if (count < 2) {
+        return detail::process_fn_impl<Width, Poly, RefIn>(algo, state, it, end);
+    }
+
+    std::vector<void *> pages(count);
+    std::vector<int> status(count, -1);
+    for (std::size_t i {0}; i < count; ++i) {
+        const auto middle {reinterpret_cast<std::uintptr_t>(it) + (i * piece) + ((std::min)(piece, len - (i * piece)) / 2)};
+        pages[i] = reinterpret_cast<void *>(middle / page_size * page_size);
+    }
+    // With no target nodes, move_pages only reports where each page is.
+    if (::syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0) {
+        std::ranges::fill(status, -1);
+    }
+
+    std::vector<std::vector<std::size_t>> queues(nodes.size());
+    for (std::size_t i {0}; i < count; ++i) {
+        const auto node {std::ranges::find(nodes, status[i], &numa_node::id)};
+        queues[node != nodes.end() ? static_cast<std::size_t>(node - nodes.begin()) : i % nodes.size()].push_back(i);
+    }
+
+    // A thread a piece at most, starting with the nodes the pieces are on.
+    std::vector<std::size_t> threads(nodes.size());
+    std::size_t total {0};
+    for (std::size_t n {0}; n < nodes.size(); ++n) {
+        threads[n] = (std::min)(static_cast<std::size_t>(CPU_COUNT(&nodes[n].cpus)), queues[n].size());
+        total += threads[n];
+    }
+    for (std::size_t n {0}; total < (std::min)(cpus, count); n = (n + 1) % nodes.size()) {
+        if (threads[n] < static_cast<std::size_t>(CPU_COUNT(&nodes[n].cpus))) {
+            ++threads[n];
+            ++total;
+        }
+    }
+
+    std::vector<least_uint<Width>> crcs(count);
+    std::vector<std::atomic<std::size_t>> next(nodes.size());
+    const auto work {[&] (const std::size_t n) noexcept {
+        for (std::size_t q {0}; q < queues.size(); ++q) {
+            const auto& queue {queues[(n + q) % queues.size()]};
+            auto& counter {next[(n + q) % queues.size()]};
+            for (std::size_t j {counter.fetch_add(1, std::memory_order_relaxed)}; j < queue.size();
+                 j = counter.fetch_add(1, std::memory_order_relaxed)) {
+                const std::size_t i {queue[j]};
+                const auto first {it + (i * piece)};
+                const auto last {first + (std::min)(piece, len - (i * piece))};
+                crcs[i] = detail::process_zero_bytes_fn_impl<Width, Poly, RefIn>(
+                    detail::process_fn_impl<Width, Poly, RefIn>(algo, (i == 0) ? state : 0, first, last),
+                    end - last);
+            }
+        }
+    }};
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(total);
+        bool short_handed {false};
+        for (std::size_t n {0}; n < nodes.size() && !short_handed; ++n) {
+            for (std::size_t t {0}; t < threads[n]; ++t) {
+                short_handed = !detail::try_start_thread(pool, [&, n] () noexcept {
+                    // On Linux, this pins just the calling thread.
+                    (void)::sched_setaffinity(0, sizeof(cpu_set_t), &nodes[n].cpus);
+                    work(n);
+                });
+                if (short_handed) {
+                    break;
+                }
+            }
+        }
+        if (short_handed) {
+            work(0);
+        }
+    }
+
+    least_uint<Width> ret {0};
+    for (const auto crc : crcs) {
+        ret ^= crc;
+    }
+    return ret;
+}
+#endif
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, typename I, typename S>
+[[nodiscard]] inline detail::least_uint<Width>
+process_fn_impl(numa_parallel_t<A>, const least_uint<Width> state, I it, S end) noexcept {
+#if defined(ZCRC_NUMA)
+    if constexpr (std::same_as<I, const char *> && std::same_as<S, const char *>) {
+        if (const auto& nodes {detail::numa_nodes()}; nodes.size() > 1) {
+            return detail::numa_parallel_fn_impl<Width, Poly, RefIn>(A {}, nodes, state, it, end);
+        }
+    }
+#endif
+    return detail::process_fn_impl<Width, Poly, RefIn>(parallel_t<A> {}, state, std::move(it), std::move(end));
+}
+
+// Fold the first [k] bits of [bits] into [crc], where 0 < k < 8. The bits are the
+// most significant ones if the input isn't reflected, and the least significant
+// ones if it is. Feeding k bits is the same as feeding a byte whose remaining
+// 8 - k bits don't exist, so it's one lookup in the slice-by-1 table.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn>
+[[nodiscard]] constexpr least_uint<Width> process_bits_fn_impl(const least_uint<Width> crc, const std::uint8_t bits, const std::size_t k) noexcept {
+    ZCRC_STATIC23 constexpr auto& t {std::get<0>(detail::tables<Width, Poly, RefIn, 1>)};
+    const auto k_mask {static_cast<std::size_t>((1U << k) - 1)};
+    if constexpr (RefIn) {
+        return detail::rshift(crc, static_cast<std::int64_t>(k)) ^ t[((crc ^ bits) & k_mask) << (8 - k)];
+    } else {
+        return (detail::lshift(crc, static_cast<std::int64_t>(k)) ^
+                t[(detail::rshift(crc, static_cast<std::int64_t>(Width - k)) ^ (bits >> (8 - k))) & k_mask])
+            & detail::bottom_n_mask<least_uint<Width>>(Width);
+    }
+}
+
+template <typename T>
+inline constexpr bool is_parallel {false};
+
+template <typename A, std::size_t TaskSize>
+inline constexpr bool is_parallel<parallel_t<A, TaskSize>> {true};
+
+template <typename A>
+inline constexpr bool is_parallel<numa_parallel_t<A>> {true};
+
+// The algorithm to use for pieces too small to be worth spreading across threads.
+template <algorithm A>
+[[nodiscard]] constexpr A sequential(const A algo) noexcept {
+    return algo;
+}
+
+template <typename A, std::size_t TaskSize>
+[[nodiscard]] constexpr A sequential(parallel_t<A, TaskSize>) noexcept {
+    return A {};
+}
+
+template <typename A>
+[[nodiscard]] constexpr A sequential(numa_parallel_t<A>) noexcept {
+    return A {};
+}
+
+// How many independent messages the multi-buffer kernels advance at once. Each
+// message is its own dependency chain through the lookup tables, so interleaving
+// them lets the CPU overlap loads that would otherwise be serialized.
+inline constexpr std::size_t lanes {4};
+
+// Process [len] bytes from each of [its] into the corresponding element of [crcs].
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t N, std::size_t Lanes, std::random_access_iterator I>
+constexpr void process_lanes_fn_impl(
+    slice_by_t<N>, std::array<least_uint<Width>, Lanes>& crcs, std::array<I, Lanes> its, const std::iter_difference_t<I> len
+) noexcept {
+    [&]<std::size_t... L>(std::index_sequence<L...>) {
+        constexpr auto n {static_cast<std::iter_difference_t<I>>(N)};
+        for (auto i {len / n}; i != 0; --i) {
+            ((crcs[L] = detail::slice<Width, Poly, RefIn, N>(crcs[L], its[L], std::make_index_sequence<N>{}), its[L] += n), ...);
+        }
+        ((crcs[L] = detail::process_fn_impl<Width, Poly, RefIn>(slice_by<N>, crcs[L], its[L], its[L] + (len % n))), ...);
+    }(std::make_index_sequence<Lanes>{});
+}
+
+// Process each of the [count] messages {it, len} = [locate](index), every one starting
+// from the state [init], and pass the resulting states in order to [sink](index, state).
+// Stops early and returns the index of the first message for which [sink] returns false;
+// returns [count] if there is none.
+//
+// Messages are taken [lanes] at a time: the lanes advance together over the shortest
+// message in the group, and then each one finishes alone. Messages of similar length
+// therefore get the full benefit of interleaving.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, std::size_t N, typename L, typename F>
+constexpr std::size_t process_batch_fn_impl(
+    slice_by_t<N>, const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink
+) {
+    std::size_t i {0};
+    for (; count - i >= detail::lanes; i += detail::lanes) {
+        const auto messages {[&]<std::size_t... M>(std::index_sequence<M...>) {
+            return std::array {locate(i + M)...};
+        }(std::make_index_sequence<detail::lanes>{})};
+        using I = typename decltype(messages)::value_type::first_type;
+
+        auto shortest {messages[0].second};
+        for (const auto& [_, len] : messages) {
+            shortest = (std::min)(shortest, len);
+        }
+
+        std::array<least_uint<Width>, detail::lanes> crcs {};
+        crcs.fill(init);
+        [&]<std::size_t... M>(std::index_sequence<M...>) {
+            detail::process_lanes_fn_impl<Width, Poly, RefIn>(
+                slice_by<N>, crcs, std::array<I, detail::lanes> {messages[M].first...}, shortest);
+        }(std::make_index_sequence<detail::lanes>{});
+
+        for (std::size_t l {0}; l < detail::lanes; ++l) {
+            const auto& [it, len] {messages[l]};
+            if (len != shortest) {
+                crcs[l] = detail::process_fn_impl<Width, Poly, RefIn>(slice_by<N>, crcs[l], it + shortest, it + len);
+            }
+            if (!sink(i + l, crcs[l])) {
+                return i + l;
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        const auto [it, len] {locate(i)};
+        if (!sink(i, detail::process_fn_impl<Width, Poly, RefIn>(slice_by<N>, init, it, it + len))) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// With a hardware kernel, each message is fast enough on its own that interleaving
+// them through the tables would only slow things down. Without one, the nibble kernel
+// can still run a message per lane, which suits short frames better than splitting each.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename L, typename F>
+inline std::size_t process_batch_fn_impl(
+    native_t, const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink
+) {
+    if (!detail::has_native_kernel<Width, Poly, RefIn>()) {
+#if defined(ZCRC_NIBBLE_KERNELS)
+        if constexpr (detail::nibble_kernel_width<Width> &&
+                      std::same_as<typename std::invoke_result_t<L&, std::size_t>::first_type, const char *>) {
+            if (detail::has_nibble_lookups()) {
+                return detail::nibble_batch_fn_impl<Width, Poly, RefIn>(init, count, locate, sink);
+            }
+        }
+#endif
+        return detail::process_batch_fn_impl<Width, Poly, RefIn>(slice_by<8>, init, count, locate, sink);
+    }
+    for (std::size_t i {0}; i < count; ++i) {
+        const auto [it, len] {locate(i)};
+        if (!sink(i, detail::process_fn_impl<Width, Poly, RefIn>(native_t {}, init, it, it + len))) {
+            return i;
+        }
+    }
+    return count;
+}
+
+// Batches are made of messages short enough to stay in the cache, so there's
+// nothing to stream.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, std::size_t Distance, typename L, typename F>
+inline std::size_t process_batch_fn_impl(
+    streaming_t<A, Distance>, const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink
+) {
+    return detail::process_batch_fn_impl<Width, Poly, RefIn>(A {}, init, count, locate, sink);
+}
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, std::size_t TaskSize, typename L, typename F>
+inline std::size_t process_batch_fn_impl(
+    parallel_t<A, TaskSize>, const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink
+) {
+#if !defined(__cpp_lib_parallel_algorithm) || __cpp_lib_parallel_algorithm < 201603L
+    return detail::process_batch_fn_impl<Width, Poly, RefIn>(A {}, init, count, locate, sink);
+#else
+    const unsigned int hardware_threads {std::jthread::hardware_concurrency()};
+    if (count < hardware_threads) {
+        // Too few messages to go around, so parallelize within each one instead.
+        for (std::size_t i {0}; i < count; ++i) {
+            const auto [it, len] {locate(i)};
+            const auto state {(static_cast<std::size_t>(len) >= 2 * parallel_min_chunk_length)
+                ? detail::process_fn_impl<Width, Poly, RefIn>(parallel_t<A, TaskSize> {}, init, it, it + len)
+                : detail::process_fn_impl<Width, Poly, RefIn>(A {}, init, it, it + len)};
+            if (!sink(i, state)) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    const std::size_t threads {(std::max)(hardware_threads, 1U)};
+    const std::size_t per_thread {count / threads};
+    const std::size_t extra {count % threads};
+    const auto indices {std::views::iota(std::size_t {0}, threads)};
+    return std::transform_reduce(
+        std::execution::par,
+        std::ranges::begin(indices),
+        std::ranges::end(indices),
+        count,
+        [] (const std::size_t lhs, const std::size_t rhs) noexcept { return (std::min)(lhs, rhs); },
+        [&] (const std::size_t t) {
+            const std::size_t first {(t * per_thread) + (std::min)(t, extra)};
+            const std::size_t n {per_thread + (t < extra ? 1 : 0)};
+            const std::size_t r {detail::process_batch_fn_impl<Width, Poly, RefIn>(
+                A {}, init, n,
+                [&] (const std::size_t i) { return locate(first + i); },
+                [&] (const std::size_t i, const least_uint<Width> state) { return sink(first + i, state); })};
+            return (r == n) ? count : first + r;
+        });
+#endif
+}
+
+// Batches are many independent messages, each typically a fraction of a page, so
+// there's no placement worth chasing; split them as parallel_t does.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, typename A, typename L, typename F>
+inline std::size_t process_batch_fn_impl(
+    numa_parallel_t<A>, const least_uint<Width> init, const std::size_t count, L&& locate, F&& sink
+) {
+    return detail::process_batch_fn_impl<Width, Poly, RefIn>(parallel_t<A> {}, init, count, locate, sink);
+}
+
+// Process each of the [count] consecutive [chunk_size]-byte chunks starting at [it],
+// as process_batch_fn_impl does.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, algorithm A, std::random_access_iterator I, typename F>
+constexpr std::size_t process_chunks_fn_impl(
+    const A algo, const least_uint<Width> init, const I it, const std::iter_difference_t<I> chunk_size, const std::size_t count, F&& sink
+) {
+    return detail::process_batch_fn_impl<Width, Poly, RefIn>(
+        algo, init, count,
+        [&] (const std::size_t i) {
+            return std::pair {it + (static_cast<std::iter_difference_t<I>>(i) * chunk_size), chunk_size};
+        },
+        sink);
+}
+
+// The bytes of a range of integers, each integer laid out in byte order E; see
+// zcrc::as_bytes. The iterator is only ever forward, so the view never looks like
+// sized random access input, and process_fn always hands it to
+// process_buffered_fn_impl, which knows how to take it apart again.
+template <std::endian E, std::forward_iterator I>
+struct as_bytes_iterator {
+    static_assert(E == std::endian::little || E == std::endian::big);
+
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = unsigned char;
+    using difference_type = std::iter_difference_t<I>;
+    using word_type = std::make_unsigned_t<std::iter_value_t<I>>;
+
+    I m_base {};
+    std::size_t m_byte {0};
+
+    [[nodiscard]] constexpr value_type operator*() const {
+        const auto n {static_cast<word_type>(*m_base)};
+        return static_cast<value_type>(n >> (8 * (E == std::endian::little ? m_byte : sizeof(word_type) - 1 - m_byte)));
+    }
+
+    constexpr as_bytes_iterator& operator++() {
+        if (++m_byte == sizeof(word_type)) {
+            m_byte = 0;
+            ++m_base;
+        }
+        return *this;
+    }
+
+    constexpr as_bytes_iterator operator++(int) {
+        auto old {*this};
+        ++*this;
+        return old;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const as_bytes_iterator& a, const as_bytes_iterator& b) {
+        return a.m_base == b.m_base && a.m_byte == b.m_byte;
+    }
+};
+
+template <typename S>
+struct as_bytes_sentinel {
+    S m_end {};
+
+    template <std::endian E, std::forward_iterator I>
+    requires std::sentinel_for<S, I>
+    [[nodiscard]] friend constexpr bool operator==(const as_bytes_iterator<E, I>& it, const as_bytes_sentinel& s) {
+        return it.m_base == s.m_end;
+    }
+};
+
+template <typename T>
+concept word_like = std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool> && sizeof(T) <= sizeof(std::uint64_t);
+
+template <std::endian E, std::ranges::view V>
+requires std::ranges::forward_range<V> && detail::word_like<std::ranges::range_value_t<V>>
+class as_bytes_view : public std::ranges::view_interface<as_bytes_view<E, V>> {
+public:
+    as_bytes_view() requires std::default_initializable<V> = default;
+
+    constexpr explicit as_bytes_view(V base) : m_base {std::move(base)} {}
+
+    [[nodiscard]] constexpr auto begin() {
+        return detail::as_bytes_iterator<E, std::ranges::iterator_t<V>> {std::ranges::begin(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto begin() const requires std::ranges::forward_range<const V> {
+        return detail::as_bytes_iterator<E, std::ranges::iterator_t<const V>> {std::ranges::begin(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto end() {
+        return detail::as_bytes_sentinel<std::ranges::sentinel_t<V>> {std::ranges::end(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto end() const requires std::ranges::forward_range<const V> {
+        return detail::as_bytes_sentinel<std::ranges::sentinel_t<const V>> {std::ranges::end(m_base)};
+    }
+
+    [[nodiscard]] constexpr auto size() requires std::ranges::sized_range<V> {
+        return std::ranges::size(m_base) * sizeof(std::ranges::range_value_t<V>);
+    }
+
+    [[nodiscard]] constexpr auto size() const requires std::ranges::sized_range<const V> {
+        return std::ranges::size(m_base) * sizeof(std::ranges::range_value_t<V>);
+    }
+
+private:
+    V m_base;
+};
+
+template <std::endian E>
+struct as_bytes_fn {
+    template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R> && detail::word_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr auto operator()(R&& r) ZCRC_CONST_CALL_OPERATOR {
+        return detail::as_bytes_view<E, std::views::all_t<R>> {std::views::all(std::forward<R>(r))};
+    }
+};
+
+template <typename I>
+inline constexpr bool is_as_bytes_iterator {false};
+
+template <std::endian E, typename I>
+inline constexpr bool is_as_bytes_iterator<as_bytes_iterator<E, I>> {true};
+
+// At runtime, input that can't be indexed into (filtered views, lists, streams, or
+// anything whose end has to be found by walking) is copied a block at a time into a
+// buffer on the stack, and each block handed to the const char * kernels (see
+// process_fn), rather than fed through slice-by-1 a byte at a time. Sized random
+// access input already gets the wide kernels through its iterators, and so does
+// contiguous input with a sentinel (like a C string); buffering those only adds a
+// copy, so they go straight through.
+template <typename I, typename S>
+inline constexpr bool buffers_input {
+    !std::contiguous_iterator<I> && !(std::random_access_iterator<I> && std::sized_sentinel_for<S, I>)
+};
+
+// zcrc::as_bytes over integers in memory. In native byte order, the integers' object
+// representation already is the byte stream, so it goes straight to the kernels;
+// otherwise, each block is byteswapped as it's copied into the buffer, which
+// compilers turn into a vector shuffle, so the kernels only ever see bytes in the
+// order they're meant to be processed.
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, algorithm A, std::endian E, typename I, typename S>
+[[nodiscard]] inline least_uint<Width> process_words_fn_impl(
+    const A algo, least_uint<Width> crc, as_bytes_iterator<E, I> it, const as_bytes_sentinel<S> end
+) {
+    using word = typename as_bytes_iterator<E, I>::word_type;
+    if constexpr (E == std::endian::native) {
+        const auto data {reinterpret_cast<const char *>(std::to_address(it.m_base))};
+        return detail::process_fn_impl<Width, Poly, RefIn>(
+            algo, crc, data + it.m_byte, data + (static_cast<std::size_t>(end.m_end - it.m_base) * sizeof(word)));
+    } else {
+        std::array<word, 4096 / sizeof(word)> buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        // Finish off a word we've been left in the middle of.
+        if (it.m_byte != 0 && it != end) {
+            const auto head {reinterpret_cast<char *>(buffer.data())};
+            std::size_t n {0};
+            for (; it.m_byte != 0; ++n, ++it) {
+                head[n] = std::bit_cast<char>(*it);
+            }
+            crc = detail::process_fn_impl<Width, Poly, RefIn>(detail::sequential(algo), crc, head, head + n);
+        }
+        auto first {std::to_address(it.m_base)};
+        const auto last {first + (end.m_end - it.m_base)};
+        const auto swap_into_buffer {[&] (const std::size_t count) {
+            for (std::size_t i {0}; i < count; ++i) {
+                auto from {static_cast<word>(first[i])};
+                word to {0};
+                for (std::size_t b {0}; b < sizeof(word); ++b, from = static_cast<word>(from >> 8)) {
+                    to = static_cast<word>((to << 8) | (from & 0xFF));
+                }
+                buffer[i] = to;
+            }
+        }};
+        while (true) {
+            const auto n {(std::min)(static_cast<std::size_t>(last - first), buffer.size())};
+            // A constant trip count lets compilers vectorize the swap even under
+            // their cheapest cost models.
+            if (n == buffer.size()) {
+                swap_into_buffer(buffer.size());
+            } else {
+                swap_into_buffer(n);
+            }
+            const auto data {reinterpret_cast<const char *>(buffer.data())};
+            crc = detail::process_fn_impl<Width, Poly, RefIn>(detail::sequential(algo), crc, data, data + (n * sizeof(word)));
+            if (n < buffer.size()) {
+                return crc;
+            }
+            first += n;
+        }
+    }
+}
+
+template <std::size_t Width, least_uint<Width> Poly, bool RefIn, algorithm A, std::input_iterator I, std::sentinel_for<I> S>
+[[nodiscard]] inline least_uint<Width> process_buffered_fn_impl(const A algo, least_uint<Width> crc, I it, const S end) {
+    if constexpr (detail::is_as_bytes_iterator<I> && (std::endian::native == std::endian::little || std::endian::native == std::endian::big)) {
+        if constexpr (std::contiguous_iterator<decltype(it.m_base)> && std::sized_sentinel_for<decltype(end.m_end), decltype(it.m_base)>) {
+            return detail::process_words_fn_impl<Width, Poly, RefIn>(algo, crc, it, end);
+        }
+    }
+    std::array<char, 4096> buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    while (true) {
+        std::size_t n {0};
+        for (; n < buffer.size() && it != end; ++n, ++it) {
+            buffer[n] = std::bit_cast<char>(static_cast<std::iter_value_t<I>>(*it));
+        }
+        const char * const data {buffer.data()};
+        crc = detail::process_fn_impl<Width, Poly, RefIn>(detail::sequential(algo), crc, data, data + n);
+        if (n < buffer.size()) {
+            return crc;
+        }
+    }
+}
+
+struct process_fn {
+    // Consider a user program that computes CRCs over several different types:
+    //
+    //    zcrc::crc32c::compute(std::span<char>)
+    //    zcrc::crc32c::compute(std::span<unsigned char>)
+    //    zcrc::crc32c::compute(std::span<char8_t>)
+    //
+    // These calls all do the exact same thing, but each is a separate template
+    // instantiation, so the compiler cannot deduplicate them in the final binary.
+    // To achieve that, those calls must type-erase their input to const char * and
+    // delegate to another function. But wait! We can't do that cast at compile time!
+    // So we need to *conditionally* do that type erasure.
+    //
+    // This is a mess, but it's what we need to do to provide a zero-overhead abstraction.
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+    requires detail::byte_like<std::iter_value_t<I>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I it, S end) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(std::is_constant_evaluated()
+            ? detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                slice_by<1>, crc.m_crc,
+                std::to_address(it),
+                std::to_address(it) + (end - it))
+            : detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                algo, crc.m_crc,
+                reinterpret_cast<const char *>(std::to_address(it)),
+                reinterpret_cast<const char *>(std::to_address(it)) + (end - it))
+        )
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::input_iterator I, std::sentinel_for<I> S>
+    requires detail::byte_like<std::iter_value_t<I>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I it, S end) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(std::is_constant_evaluated()
+            ? detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                slice_by<1>, crc.m_crc, std::move(it), std::move(end))
+            : detail::buffers_input<I, S>
+            ? detail::process_buffered_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                algo, crc.m_crc, std::move(it), std::move(end))
+            : detail::process_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                algo, crc.m_crc, std::move(it), std::move(end)))
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::ranges::input_range R>
+    requires detail::byte_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(process_fn::operator()(algo, crc, std::ranges::begin(r), std::ranges::end(r)))
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::input_iterator I, std::sentinel_for<I> S>
+    requires detail::byte_like<std::iter_value_t<I>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, I begin, S end) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(process_fn::operator()(default_algorithm, crc, std::move(begin), std::move(end)))
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::ranges::input_range R>
+    requires detail::byte_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(process_fn::operator()(crc, std::ranges::begin(r), std::ranges::end(r)))
+};
+
+struct process_repeated_fn {
+    // Returns the state after processing [count] back-to-back copies of [pattern],
+    // in logarithmic time. One copy maps a state s to s · x^8L + c, where L is the
+    // pattern's length and c is what the pattern leaves behind in a zeroed register;
+    // applying that map n times is then exponentiation by squaring.
+    // Precondition: count >= 0
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              std::ranges::forward_range R, std::integral N>
+    requires detail::byte_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(crc<Width, Poly, Init, RefIn, RefOut, XOROut> state, R&& pattern, const N count) ZCRC_CONST_CALL_OPERATOR {
+        using crc_t = crc<Width, Poly, Init, RefIn, RefOut, XOROut>;
+        constexpr std::size_t w {Width < 8 ? 8 : Width};
+        constexpr typename crc_t::crc_type p {Width < 8 ? Poly << (8 - Width) : Poly};
+
+        auto shift {detail::x8n_mod_p<w, p, RefIn>(static_cast<std::uint64_t>(std::ranges::distance(pattern)))};
+        auto offset {process_fn {}(crc_t {typename crc_t::crc_type {0}}, pattern).m_crc};
+        for (auto n {static_cast<std::make_unsigned_t<N>>(count)}; n != 0; n >>= 1) {
+            if (detail::bit_is_set(n, 0)) {
+                state.m_crc = detail::clmul_over_field<w, p, RefIn>(state.m_crc, shift) ^ offset;
+            }
+            if (n != 1) {
+                offset ^= detail::clmul_over_field<w, p, RefIn>(offset, shift);
+                shift = detail::clmul_over_field<w, p, RefIn>(shift, shift);
+            }
+        }
+        return state;
+    }
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              detail::byte_like B, std::integral N>
+    requires (!std::ranges::range<B>) // std::array<char, 1> is byte-like too.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> state, const B byte, const N count) ZCRC_CONST_CALL_OPERATOR noexcept {
+        return process_repeated_fn::operator()(state, std::array<B, 1> {byte}, count);
+    }
+};
+
+// The type-erasing front end of process_chunks_fn_impl (see process_fn), handing
+// [sink] CRC objects rather than raw state.
+struct process_chunks_fn {
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              detail::byte_buffer R, typename F>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> init,
+               R&& r, const std::size_t chunk_size, const std::size_t count, F&& sink) ZCRC_CONST_CALL_OPERATOR {
+        using crc_t = crc<Width, Poly, Init, RefIn, RefOut, XOROut>;
+        const auto run {[&] (const auto algo_, const auto it) {
+            return detail::process_chunks_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                algo_, init.m_crc, it,
+                static_cast<std::iter_difference_t<decltype(it)>>(chunk_size), count,
+                [&] (const std::size_t i, const typename crc_t::crc_type state) { return sink(i, crc_t {state}); });
+        }};
+        return std::is_constant_evaluated()
+            ? run(slice_by<1>, std::ranges::begin(r))
+            : run(algo, reinterpret_cast<const char *>(std::ranges::data(r)));
+    }
+};
+
+inline constexpr detail::process_chunks_fn process_chunks {};
+
+// The type-erasing front end of process_batch_fn_impl (see process_fn). Here, [locate]
+// returns each message as a contiguous range of bytes.
+struct process_batch_fn {
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut,
+              typename L, typename F>
+    requires detail::byte_buffer<std::invoke_result_t<L&, std::size_t>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> init,
+               const std::size_t count, L&& locate, F&& sink) ZCRC_CONST_CALL_OPERATOR {
+        using crc_t = crc<Width, Poly, Init, RefIn, RefOut, XOROut>;
+        const auto run {[&] (const auto algo_, const auto erase) {
+            return detail::process_batch_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                algo_, init.m_crc, count,
+                [&] (const std::size_t i) {
+                    auto&& message {locate(i)};
+                    const auto it {erase(message)};
+                    return std::pair {it, static_cast<std::iter_difference_t<decltype(it)>>(std::ranges::size(message))};
+                },
+                [&] (const std::size_t i, const typename crc_t::crc_type state) { return sink(i, crc_t {state}); });
+        }};
+        return std::is_constant_evaluated()
+            ? run(slice_by<1>, [] (auto&& message) { return std::ranges::begin(message); })
+            : run(algo, [] (auto&& message) { return reinterpret_cast<const char *>(std::ranges::data(message)); });
+    }
+};
+
+inline constexpr detail::process_batch_fn process_batch {};
+
+struct process_bits_fn {
+    // Like process, but only processes the first [bit_count] bits of [r], for frames
+    // that aren't a whole number of bytes long: that is, all of the first bit_count / 8
+    // bytes, then bit_count % 8 bits of the next, starting from its most significant
+    // bit if the CRC's input isn't reflected, and from its least significant otherwise.
+    //
+    // Precondition: bit_count <= 8 * std::ranges::size(r)
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut, detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const algorithm auto algo, const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r, const std::uint64_t bit_count) ZCRC_CONST_CALL_OPERATOR {
+        const auto it {std::ranges::begin(r)};
+        const auto bytes {static_cast<std::ranges::range_difference_t<R>>(bit_count / 8)};
+        auto state {detail::process_fn {}(algo, crc, it, it + bytes)};
+        if (bit_count % 8 != 0) {
+            state.m_crc = detail::process_bits_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                state.m_crc, static_cast<std::uint8_t>(it[bytes]), bit_count % 8);
+        }
+        return state;
+    }
+
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut, detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc<Width, Poly, Init, RefIn, RefOut, XOROut>
+    operator()(const crc<Width, Poly, Init, RefIn, RefOut, XOROut> crc, R&& r, const std::uint64_t bit_count) ZCRC_CONST_CALL_OPERATOR {
+        return process_bits_fn::operator()(default_algorithm, crc, r, bit_count);
+    }
+};
+
+struct finalize_fn {
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr least_uint<Width>
+    operator()(crc<Width, Poly, Init, RefIn, RefOut, XOROut> state) ZCRC_CONST_CALL_OPERATOR noexcept {
+        if constexpr (Width < 8 && !RefIn) {
+            state.m_crc >>= 8 - Width;
+        }
+
+        if constexpr (RefIn != RefOut) {
+            state.m_crc = detail::reflect(state.m_crc, Width);
+        }
+
+        return state.m_crc ^ XOROut;
+    }
+};
+
+struct is_valid_fn {
+    template <std::size_t Width, auto Poly, auto Init, bool RefIn, bool RefOut, auto XOROut>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
+    operator()(crc<Width, Poly, Init, RefIn, RefOut, XOROut> state) ZCRC_CONST_CALL_OPERATOR noexcept {
+        ZCRC_STATIC23 constexpr least_uint<Width> residue {[] {
+            least_uint<Width> residue_ {XOROut};
+
+            for (std::size_t i {0}; i < Width; ++i) {
+                residue_ = (residue_ << 1) ^ (detail::bit_is_set(residue_, Width - 1) ? Poly : 0);
+            }
+
+            residue_ &= detail::bottom_n_mask<least_uint<Width>>(Width);
+
+            if constexpr (RefIn) {
+                return detail::reflect(residue_, Width);
+            } else if constexpr (Width < 8) {
+                return residue_ << (8 - Width);
+            } else {
+                return residue_;
+            }
+        }()};
+
+        return state.m_crc == residue;
+    }
+};
+
+} // namespace detail
+
+ZCRC_EXPORT inline constexpr detail::combine_fn combine {};
+ZCRC_EXPORT inline constexpr detail::process_zero_bytes_fn process_zero_bytes {};
+ZCRC_EXPORT inline constexpr detail::compose_fn compose {};
+ZCRC_EXPORT inline constexpr detail::process_fn process {};
+ZCRC_EXPORT inline constexpr detail::process_repeated_fn process_repeated {};
+ZCRC_EXPORT template <std::endian E>
+inline constexpr detail::as_bytes_fn<E> as_bytes {};
+ZCRC_EXPORT inline constexpr detail::process_bits_fn process_bits {};
+ZCRC_EXPORT inline constexpr detail::finalize_fn finalize {};
+ZCRC_EXPORT inline constexpr detail::is_valid_fn is_valid {};
+
+ZCRC_EXPORT struct zero_init_t {
+    explicit zero_init_t() = default;
+};
+
+ZCRC_EXPORT inline constexpr zero_init_t zero_init {};
+
+ZCRC_EXPORT struct from_finalized_t {
+    explicit from_finalized_t() = default;
+};
+
+ZCRC_EXPORT inline constexpr from_finalized_t from_finalized {};
+
+template <
+    std::size_t Width,
+    detail::least_uint<Width> Poly,
+    detail::least_uint<Width> Init,
+    bool RefIn,
+    bool RefOut,
+    detail::least_uint<Width> XOROut
+>
+class crc {
+public:
+    using crc_type = detail::least_uint<Width>;
+
+private:
+    crc_type m_crc {[] () noexcept {
+        if constexpr (RefIn) {
+            return detail::reflect(Init, Width);
+        } else if constexpr (Width < 8) {
+            return Init << (8 - Width);
+        } else {
+            return Init;
+        }
+    }()};
+
+    [[nodiscard]] constexpr crc(const crc_type crc) noexcept : m_crc {crc} {}
+
+    friend struct detail::combine_fn;
+    friend struct detail::process_zero_bytes_fn;
+    friend struct detail::compose_fn;
+    friend struct detail::process_fn;
+    friend struct detail::process_repeated_fn;
+    friend struct detail::process_chunks_fn;
+    friend struct detail::process_batch_fn;
+    friend struct detail::process_bits_fn;
+    friend struct detail::finalize_fn;
+    friend struct detail::is_valid_fn;
+
+    struct compute_member_fn {
+        template <std::input_iterator I, std::sentinel_for<I> S>
         requires detail::byte_like<std::iter_value_t<I>>
         [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
         operator()(const algorithm auto algo, I begin, S end) ZCRC_CONST_CALL_OPERATOR
             ZCRC_RETURNS(finalize(process(algo, crc {}, std::move(begin), std::move(end))))
 
-        template <std::ranges::input_range R>
-        requires detail::byte_like<std::ranges::range_value_t<R>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
-        operator()(const algorithm auto algo, R&& r) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(compute_member_fn::operator()(algo, std::ranges::begin(r), std::ranges::end(r)))
+        template <std::ranges::input_range R>
+        requires detail::byte_like<std::ranges::range_value_t<R>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
+        operator()(const algorithm auto algo, R&& r) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(compute_member_fn::operator()(algo, std::ranges::begin(r), std::ranges::end(r)))
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires detail::byte_like<std::iter_value_t<I>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
+        operator()(I begin, S end) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(compute_member_fn::operator()(default_algorithm, std::move(begin), std::move(end)))
+
+        template <std::ranges::input_range R>
+        requires detail::byte_like<std::ranges::range_value_t<R>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
+        operator()(R&& r) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(compute_member_fn::operator()(default_algorithm, std::ranges::begin(r), std::ranges::end(r)))
+    };
+
+    struct is_valid_member_fn {
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires detail::byte_like<std::iter_value_t<I>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
+        operator()(const algorithm auto algo, I begin, S end) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(::zcrc::is_valid(process(algo, crc {}, std::move(begin), std::move(end))))
+
+        template <std::ranges::input_range R>
+        requires detail::byte_like<std::ranges::range_value_t<R>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
+        operator()(const algorithm auto algo, R&& r) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(is_valid_member_fn::operator()(algo, std::ranges::begin(r), std::ranges::end(r)))
+
+        template <std::input_iterator I, std::sentinel_for<I> S>
+        requires detail::byte_like<std::iter_value_t<I>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
+        operator()(I begin, S end) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(is_valid_member_fn::operator()(default_algorithm, std::move(begin), std::move(end)))
+
+        template <std::ranges::input_range R>
+        requires detail::byte_like<std::ranges::range_value_t<R>>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
+        operator()(R&& r) ZCRC_CONST_CALL_OPERATOR
+            ZCRC_RETURNS(is_valid_member_fn::operator()(default_algorithm, std::ranges::begin(r), std::ranges::end(r)))
+    };
+
+    struct compute_chunked_member_fn {
+        // Writes the CRC of each consecutive [chunk_size]-byte chunk of [r] to [out].
+        // The last chunk may be shorter.
+        //
+        // Precondition: chunk_size > 0, and std::ranges::size(out) >= ceil(std::ranges::size(r) / chunk_size)
+        template <detail::byte_buffer R, std::ranges::random_access_range O>
+        requires std::ranges::output_range<O, crc_type>
+        ZCRC_STATIC_CALL_OPERATOR constexpr void
+        operator()(const algorithm auto algo, R&& r, const std::size_t chunk_size, O&& out) ZCRC_CONST_CALL_OPERATOR {
+            const auto size {static_cast<std::size_t>(std::ranges::size(r))};
+            const auto out_it {std::ranges::begin(out)};
+            (void)detail::process_chunks(algo, crc {}, r, chunk_size, size / chunk_size, [&] (const std::size_t i, const crc c) {
+                out_it[static_cast<std::ranges::range_difference_t<O>>(i)] = finalize(c);
+                return true;
+            });
+            if (size % chunk_size != 0) {
+                // The tail is shorter than a chunk, so it isn't worth splitting further.
+                out_it[static_cast<std::ranges::range_difference_t<O>>(size / chunk_size)] = compute(
+                    detail::sequential(algo), std::ranges::begin(r) + static_cast<std::ranges::range_difference_t<R>>(size - (size % chunk_size)), std::ranges::end(r));
+            }
+        }
+
+        template <detail::byte_buffer R, std::ranges::random_access_range O>
+        requires std::ranges::output_range<O, crc_type>
+        ZCRC_STATIC_CALL_OPERATOR constexpr void
+        operator()(R&& r, const std::size_t chunk_size, O&& out) ZCRC_CONST_CALL_OPERATOR {
+            compute_chunked_member_fn::operator()(default_algorithm, r, chunk_size, out);
+        }
+    };
+
+    struct verify_chunked_member_fn {
+        // Returns the index of the first chunk whose CRC doesn't match [expected], or the
+        // number of chunks if they all do. Chunks are as in compute_chunked.
+        //
+        // Precondition: chunk_size > 0
+        template <detail::byte_buffer R, std::ranges::random_access_range E>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<E>, crc_type>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(const algorithm auto algo, R&& r, const std::size_t chunk_size, E&& expected) ZCRC_CONST_CALL_OPERATOR {
+            const auto size {static_cast<std::size_t>(std::ranges::size(r))};
+            const auto expected_it {std::ranges::begin(expected)};
+            const std::size_t full_chunks {size / chunk_size};
+            const std::size_t i {detail::process_chunks(algo, crc {}, r, chunk_size, full_chunks, [&] (const std::size_t i_, const crc c) {
+                return finalize(c) == expected_it[static_cast<std::ranges::range_difference_t<E>>(i_)];
+            })};
+            if (i != full_chunks || size % chunk_size == 0) {
+                return i;
+            }
+            return compute(
+                detail::sequential(algo), std::ranges::begin(r) + static_cast<std::ranges::range_difference_t<R>>(size - (size % chunk_size)), std::ranges::end(r)
+            ) == expected_it[static_cast<std::ranges::range_difference_t<E>>(full_chunks)] ? full_chunks + 1 : full_chunks;
+        }
+
+        template <detail::byte_buffer R, std::ranges::random_access_range E>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<E>, crc_type>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(R&& r, const std::size_t chunk_size, E&& expected) ZCRC_CONST_CALL_OPERATOR {
+            return verify_chunked_member_fn::operator()(default_algorithm, r, chunk_size, expected);
+        }
+    };
+
+    struct combine_chunked_member_fn {
+        // Given the CRCs of the chunks of a [total_size]-byte message, as computed by
+        // compute_chunked, returns the CRC of the whole message without rereading it.
+        //
+        // Precondition: chunk_size > 0, and std::ranges::size(crcs) == ceil(total_size / chunk_size)
+        template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, crc_type>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
+        operator()(R&& crcs, const std::uint64_t chunk_size, std::uint64_t total_size) ZCRC_CONST_CALL_OPERATOR noexcept {
+            constexpr std::size_t w {Width < 8 ? 8 : Width};
+            constexpr crc_type p {Width < 8 ? Poly << (8 - Width) : Poly};
+            const crc_type shift {detail::x8n_mod_p<w, p, RefIn>(chunk_size)};
+
+            crc whole {};
+            for (const crc_type c : crcs) {
+                const std::uint64_t len {(std::min)(chunk_size, total_size)};
+                total_size -= len;
+                // CRC(A || B) = CRC(A) · x^8|B| + CRC(B), except that both started from Init,
+                // so A's copy of it must be cancelled out before shifting.
+                whole = combine(whole, crc {});
+                whole.m_crc = (len == chunk_size)
+                    ? detail::clmul_over_field<w, p, RefIn>(whole.m_crc, shift)
+                    : process_zero_bytes(whole, len).m_crc;
+                whole = combine(whole, crc {from_finalized, c});
+            }
+            return finalize(whole);
+        }
+    };
+
+    struct verify_parts_member_fn {
+        // Returns the index of the first of [parts] whose CRC doesn't match [expected],
+        // or the number of parts if they all do.
+        template <std::ranges::random_access_range P, std::ranges::random_access_range E>
+        requires std::ranges::sized_range<P> && detail::byte_buffer<std::ranges::range_reference_t<P>> &&
+                 std::equality_comparable_with<std::ranges::range_reference_t<E>, crc_type>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(const algorithm auto algo, P&& parts, E&& expected) ZCRC_CONST_CALL_OPERATOR {
+            const auto parts_it {std::ranges::begin(parts)};
+            const auto expected_it {std::ranges::begin(expected)};
+            return detail::process_batch(algo, crc {}, static_cast<std::size_t>(std::ranges::size(parts)),
+                [&] (const std::size_t i) -> decltype(auto) {
+                    return parts_it[static_cast<std::ranges::range_difference_t<P>>(i)];
+                },
+                [&] (const std::size_t i, const crc c) {
+                    return finalize(c) == expected_it[static_cast<std::ranges::range_difference_t<E>>(i)];
+                });
+        }
+
+        template <std::ranges::random_access_range P, std::ranges::random_access_range E>
+        requires std::ranges::sized_range<P> && detail::byte_buffer<std::ranges::range_reference_t<P>> &&
+                 std::equality_comparable_with<std::ranges::range_reference_t<E>, crc_type>
+        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(P&& parts, E&& expected) ZCRC_CONST_CALL_OPERATOR {
+            return verify_parts_member_fn::operator()(default_algorithm, parts, expected);
+        }
+    };
+
+    struct verify_frames_member_fn {
+        // Checks each of [frames], which end in their CRC (as for is_valid), and writes
+        // the results to [out] as a bitmap: bit i % 64 of word i / 64 is set if frame
+        // i is intact. Returns the number of intact frames. A frame is either a buffer,
+        // or a (buffer, length in bits) pair for frames that aren't a whole number of
+        // bytes long (see process_bits).
+        //
+        // Precondition: std::ranges::size(out) >= ceil(std::ranges::size(frames) / 64)
+        template <std::ranges::random_access_range F, std::ranges::random_access_range O>
+        requires std::ranges::sized_range<F> &&
+                 (detail::byte_buffer<std::ranges::range_reference_t<F>> || detail::bit_frame<std::ranges::range_value_t<F>>) &&
+                 std::ranges::output_range<O, std::uint64_t>
+        ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(const algorithm auto algo, F&& frames, O&& out) ZCRC_CONST_CALL_OPERATOR {
+            const auto count {static_cast<std::size_t>(std::ranges::size(frames))};
+            const auto frames_it {std::ranges::begin(frames)};
+            const auto out_it {std::ranges::begin(out)};
+
+            // Each word is filled by one sequential batch, so threads never share one.
+            const auto check_word {[&] (const std::size_t w) {
+                const std::size_t first {w * 64};
+                std::uint64_t word {0};
+                (void)detail::process_batch(detail::sequential(algo), crc {}, (std::min)(count - first, std::size_t {64}),
+                    [&] (const std::size_t i) -> decltype(auto) {
+                        const auto index {static_cast<std::ranges::range_difference_t<F>>(first + i)};
+                        if constexpr (detail::byte_buffer<std::ranges::range_reference_t<F>>) {
+                            return frames_it[index];
+                        } else {
+                            // The whole bytes go through the batch; the leftover bits are folded in below.
+                            const auto& frame {frames_it[index]};
+                            return std::span {std::ranges::data(std::get<0>(frame)), static_cast<std::size_t>(std::get<1>(frame) / 8)};
+                        }
+                    },
+                    [&] (const std::size_t i, crc c) {
+                        if constexpr (!detail::byte_buffer<std::ranges::range_reference_t<F>>) {
+                            const auto& frame {frames_it[static_cast<std::ranges::range_difference_t<F>>(first + i)]};
+                            const auto bit_count {static_cast<std::uint64_t>(std::get<1>(frame))};
+                            if (bit_count % 8 != 0) {
+                                c.m_crc = detail::process_bits_fn_impl<Width < 8 ? 8 : Width, Width < 8 ? Poly << (8 - Width) : Poly, RefIn>(
+                                    c.m_crc, static_cast<std::uint8_t>(std::ranges::data(std::get<0>(frame))[bit_count / 8]), bit_count % 8);
+                            }
+                        }
+                        word |= static_cast<std::uint64_t>(::zcrc::is_valid(c)) << i;
+                        return true;
+                    });
+                out_it[static_cast<std::ranges::range_difference_t<O>>(w)] = word;
+                return static_cast<std::size_t>(std::popcount(word));
+            }};
+
+            const std::size_t words {(count + 63) / 64};
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L
+            if constexpr (detail::is_parallel<std::remove_cvref_t<decltype(algo)>>) {
+                const auto indices {std::views::iota(std::size_t {0}, words)};
+                return std::transform_reduce(std::execution::par, std::ranges::begin(indices), std::ranges::end(indices),
+                    std::size_t {0},
+                    [] (const std::size_t lhs, const std::size_t rhs) noexcept { return lhs + rhs; },
+                    check_word);
+            } else
+#endif
+            {
+                std::size_t valid {0};
+                for (std::size_t w {0}; w < words; ++w) {
+                    valid += check_word(w);
+                }
+                return valid;
+            }
+        }
+
+        template <std::ranges::random_access_range F, std::ranges::random_access_range O>
+        requires std::ranges::sized_range<F> &&
+                 (detail::byte_buffer<std::ranges::range_reference_t<F>> || detail::bit_frame<std::ranges::range_value_t<F>>) &&
+                 std::ranges::output_range<O, std::uint64_t>
+        ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+        operator()(F&& frames, O&& out) ZCRC_CONST_CALL_OPERATOR {
+            return verify_frames_member_fn::operator()(default_algorithm, frames, out);
+        }
+    };
+
+public:
+    static_assert(Width != 0);
+    static_assert(std::numeric_limits<crc_type>::digits >= Width);
+    static_assert((Poly & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
+    static_assert((Init & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
+    static_assert((XOROut & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
+
+    static constexpr std::size_t width {Width};
+    static constexpr crc_type poly {Poly};
+    static constexpr crc_type init {Init};
+    static constexpr bool refin {RefIn};
+    static constexpr bool refout {RefOut};
+    static constexpr crc_type xorout {XOROut};
+
+    [[nodiscard]] constexpr crc() noexcept = default;
+    [[nodiscard]] explicit constexpr crc(zero_init_t) noexcept : m_crc {0} {}
+
+    // The inverse of zcrc::finalize: recovers the state that finalizes to [result],
+    // so that a CRC computed elsewhere (say, by zlib) can be resumed.
+    [[nodiscard]] explicit constexpr crc(from_finalized_t, const crc_type result) noexcept
+        : m_crc {[&] () noexcept {
+            crc_type r {static_cast<crc_type>((result ^ XOROut) & detail::bottom_n_mask<crc_type>(Width))};
+            if constexpr (RefIn != RefOut) {
+                r = detail::reflect(r, Width);
+            }
+            if constexpr (Width < 8 && !RefIn) {
+                r <<= 8 - Width;
+            }
+            return r;
+        }()} {}
+    [[nodiscard]] friend constexpr bool operator==(crc, crc) noexcept = default;
+
+    static constexpr compute_member_fn compute {};
+    static constexpr is_valid_member_fn is_valid {};
+    static constexpr compute_chunked_member_fn compute_chunked {};
+    static constexpr verify_chunked_member_fn verify_chunked {};
+    static constexpr combine_chunked_member_fn combine_chunked {};
+    static constexpr verify_parts_member_fn verify_parts {};
+    static constexpr verify_frames_member_fn verify_frames {};
+};
+
+// clang-format off
+
+ZCRC_EXPORT using crc3_gsm                = crc<3,      0x3,      0x0, false, false,      0x7>; // academic
+ZCRC_EXPORT using crc3_rohc               = crc<3,      0x3,      0x7,  true,  true,      0x0>; // academic
+ZCRC_EXPORT using crc4_g_704              = crc<4,      0x3,      0x0,  true,  true,      0x0>; // academic
+ZCRC_EXPORT using crc4_interlaken         = crc<4,      0x3,      0xF, false, false,      0xF>; // academic
+ZCRC_EXPORT using crc5_epc_c1g2           = crc<5,     0x09,     0x09, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc5_g_704              = crc<5,     0x15,     0x00,  true,  true,     0x00>; // academic
+ZCRC_EXPORT using crc5_usb                = crc<5,     0x05,     0x1F,  true,  true,     0x1F>; // confirmed
+ZCRC_EXPORT using crc6_cdma2000_a         = crc<6,     0x27,     0x3F, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc6_cdma2000_b         = crc<6,     0x07,     0x3F, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc6_darc               = crc<6,     0x19,     0x00,  true,  true,     0x00>; // attested
+ZCRC_EXPORT using crc6_g_704              = crc<6,     0x03,     0x00,  true,  true,     0x00>; // academic
+ZCRC_EXPORT using crc6_gsm                = crc<6,     0x2F,     0x00, false, false,     0x3F>; // academic
+ZCRC_EXPORT using crc7_mmc                = crc<7,     0x09,     0x00, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc7_rohc               = crc<7,     0x4F,     0x7F,  true,  true,     0x00>; // academic
+ZCRC_EXPORT using crc7_umts               = crc<7,     0x45,     0x00, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc8_autosar            = crc<8,     0x2F,     0xFF, false, false,     0xFF>; // attested
+ZCRC_EXPORT using crc8_bluetooth          = crc<8,     0xA7,     0x00,  true,  true,     0x00>; // attested
+ZCRC_EXPORT using crc8_cdma2000           = crc<8,     0x9B,     0xFF, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc8_darc               = crc<8,     0x39,     0x00,  true,  true,     0x00>; // attested
+ZCRC_EXPORT using crc8_dvb_s2             = crc<8,     0xD5,     0x00, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc8_gsm_a              = crc<8,     0x1D,     0x00, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc8_gsm_b              = crc<8,     0x49,     0x00, false, false,     0xFF>; // academic
+ZCRC_EXPORT using crc8_hitag              = crc<8,     0x1D,     0xFF, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_i_432_1            = crc<8,     0x07,     0x00, false, false,     0x55>; // academic
+ZCRC_EXPORT using crc8_i_code             = crc<8,     0x1D,     0xFD, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_lte                = crc<8,     0x9B,     0x00, false, false,     0x00>; // academic
+ZCRC_EXPORT using crc8_maxim_dow          = crc<8,     0x31,     0x00,  true,  true,     0x00>; // attested
+ZCRC_EXPORT using crc8_mifare_mad         = crc<8,     0x1D,     0xC7, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_nrsc_5             = crc<8,     0x31,     0xFF, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_opensafety         = crc<8,     0x2F,     0x00, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_rohc               = crc<8,     0x07,     0xFF,  true,  true,     0x00>; // academic
+ZCRC_EXPORT using crc8_sae_j1850          = crc<8,     0x1D,     0xFF, false, false,     0xFF>; // attested
+ZCRC_EXPORT using crc8_smbus              = crc<8,     0x07,     0x00, false, false,     0x00>; // attested
+ZCRC_EXPORT using crc8_tech_3250          = crc<8,     0x1D,     0xFF,  true,  true,     0x00>; // attested
+ZCRC_EXPORT using crc8_wcdma              = crc<8,     0x9B,     0x00,  true,  true,     0x00>; // third_party
+ZCRC_EXPORT using crc10_atm               = crc<10,    0x233,    0x000, false, false,    0x000>; // attested
+ZCRC_EXPORT using crc10_cdma2000          = crc<10,    0x3D9,    0x3FF, false, false,    0x000>; // academic
+ZCRC_EXPORT using crc10_gsm               = crc<10,    0x175,    0x000, false, false,    0x3FF>; // academic
+ZCRC_EXPORT using crc11_flexray           = crc<11,    0x385,    0x01A, false, false,    0x000>; // attested
+ZCRC_EXPORT using crc11_umts              = crc<11,    0x307,    0x000, false, false,    0x000>; // academic
+ZCRC_EXPORT using crc12_cdma2000          = crc<12,    0xF13,    0xFFF, false, false,    0x000>; // academic
+ZCRC_EXPORT using crc12_dect              = crc<12,    0x80F,    0x000, false, false,    0x000>; // academic
+ZCRC_EXPORT using crc12_gsm               = crc<12,    0xD31,    0x000, false, false,    0xFFF>; // academic
+ZCRC_EXPORT using crc12_umts              = crc<12,    0x80F,    0x000, false,  true,    0x000>; // academic
+ZCRC_EXPORT using crc13_bbc               = crc<13,   0x1CF5,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc14_darc              = crc<14,   0x0805,   0x0000,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc14_gsm               = crc<14,   0x202D,   0x0000, false, false,   0x3FFF>; // academic
+ZCRC_EXPORT using crc15_can               = crc<15,   0x4599,   0x0000, false, false,   0x0000>; // academic
+ZCRC_EXPORT using crc15_mpt1327           = crc<15,   0x6815,   0x0000, false, false,   0x0001>; // attested
+ZCRC_EXPORT using crc16_arc               = crc<16,   0x8005,   0x0000,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_cdma2000          = crc<16,   0xC867,   0xFFFF, false, false,   0x0000>; // academic
+ZCRC_EXPORT using crc16_cms               = crc<16,   0x8005,   0xFFFF, false, false,   0x0000>; // third_party
+ZCRC_EXPORT using crc16_dds_110           = crc<16,   0x8005,   0x800D, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_dect_r            = crc<16,   0x0589,   0x0000, false, false,   0x0001>; // attested
+ZCRC_EXPORT using crc16_dect_x            = crc<16,   0x0589,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_dnp               = crc<16,   0x3D65,   0x0000,  true,  true,   0xFFFF>; // confirmed
+ZCRC_EXPORT using crc16_en_13757          = crc<16,   0x3D65,   0x0000, false, false,   0xFFFF>; // confirmed
+ZCRC_EXPORT using crc16_genibus           = crc<16,   0x1021,   0xFFFF, false, false,   0xFFFF>; // attested
+ZCRC_EXPORT using crc16_gsm               = crc<16,   0x1021,   0x0000, false, false,   0xFFFF>; // attested
+ZCRC_EXPORT using crc16_ibm_3740          = crc<16,   0x1021,   0xFFFF, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_ibm_sdlc          = crc<16,   0x1021,   0xFFFF,  true,  true,   0xFFFF>; // attested
+ZCRC_EXPORT using crc16_iso_iec_14443_3_a = crc<16,   0x1021,   0xC6C6,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_kermit            = crc<16,   0x1021,   0x0000,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_lj1200            = crc<16,   0x6F63,   0x0000, false, false,   0x0000>; // third_party
+ZCRC_EXPORT using crc16_m17               = crc<16,   0x5935,   0xFFFF, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_maxim_dow         = crc<16,   0x8005,   0x0000,  true,  true,   0xFFFF>; // attested
+ZCRC_EXPORT using crc16_mcrf4xx           = crc<16,   0x1021,   0xFFFF,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_modbus            = crc<16,   0x8005,   0xFFFF,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_nrsc_5            = crc<16,   0x080B,   0xFFFF,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_opensafety_a      = crc<16,   0x5935,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_opensafety_b      = crc<16,   0x755B,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_profibus          = crc<16,   0x1DCF,   0xFFFF, false, false,   0xFFFF>; // attested
+ZCRC_EXPORT using crc16_riello            = crc<16,   0x1021,   0xB2AA,  true,  true,   0x0000>; // third_party
+ZCRC_EXPORT using crc16_spi_fujitsu       = crc<16,   0x1021,   0x1D0F, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_t10_dif           = crc<16,   0x8BB7,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_teledisk          = crc<16,   0xA097,   0x0000, false, false,   0x0000>; // confirmed
+ZCRC_EXPORT using crc16_tms37157          = crc<16,   0x1021,   0x89EC,  true,  true,   0x0000>; // attested
+ZCRC_EXPORT using crc16_umts              = crc<16,   0x8005,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc16_usb               = crc<16,   0x8005,   0xFFFF,  true,  true,   0xFFFF>; // confirmed
+ZCRC_EXPORT using crc16_xmodem            = crc<16,   0x1021,   0x0000, false, false,   0x0000>; // attested
+ZCRC_EXPORT using crc17_can_fd            = crc<17,  0x1685B,  0x00000, false, false,  0x00000>; // academic
+ZCRC_EXPORT using crc21_can_fd            = crc<21, 0x102899, 0x000000, false, false, 0x000000>; // academic
+ZCRC_EXPORT using crc24_ble               = crc<24, 0x00065B, 0x555555,  true,  true, 0x000000>; // attested
+ZCRC_EXPORT using crc24_flexray_a         = crc<24, 0x5D6DCB, 0xFEDCBA, false, false, 0x000000>; // attested
+ZCRC_EXPORT using crc24_flexray_b         = crc<24, 0x5D6DCB, 0xABCDEF, false, false, 0x000000>; // attested
+ZCRC_EXPORT using crc24_interlaken        = crc<24, 0x328B63, 0xFFFFFF, false, false, 0xFFFFFF>; // academic
+ZCRC_EXPORT using crc24_lte_a             = crc<24, 0x864CFB, 0x000000, false, false, 0x000000>; // academic
+ZCRC_EXPORT using crc24_lte_b             = crc<24, 0x800063, 0x000000, false, false, 0x000000>; // academic
+ZCRC_EXPORT using crc24_openpgp           = crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>; // attested
+ZCRC_EXPORT using crc24_os_9              = crc<24, 0x800063, 0xFFFFFF, false, false, 0xFFFFFF>; // attested
+ZCRC_EXPORT using crc30_cdma              = crc<30, 0x2030B9C7, 0x3FFFFFFF, false, false, 0x3FFFFFFF>; // academic
+ZCRC_EXPORT using crc31_philips           = crc<31, 0x04C11DB7, 0x7FFFFFFF, false, false, 0x7FFFFFFF>; // confirmed
+ZCRC_EXPORT using crc32_aixm              = crc<32, 0x814141AB, 0x00000000, false, false, 0x00000000>; // attested
+ZCRC_EXPORT using crc32_autosar           = crc<32, 0xF4ACFB13, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
+ZCRC_EXPORT using crc32_base91_d          = crc<32, 0xA833982B, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // confirmed
+ZCRC_EXPORT using crc32                   = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>; // attested
+ZCRC_EXPORT using crc32_cd_rom_edc        = crc<32, 0x8001801B, 0x00000000,  true,  true, 0x00000000>; // academic
+ZCRC_EXPORT using crc32_cksum             = crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF>; // attested
+ZCRC_EXPORT using crc32c                  = crc<32, 0x1EDC6F41, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
+ZCRC_EXPORT using crc32_iso_hdlc          = crc<32, 0x04C11DB7, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
+ZCRC_EXPORT using crc32_jamcrc            = crc<32, 0x04C11DB7, 0xFFFFFFFF,  true,  true, 0x00000000>; // confirmed
+ZCRC_EXPORT using crc32_mef               = crc<32, 0x741B8CD7, 0xFFFFFFFF,  true,  true, 0x00000000>; // attested
+ZCRC_EXPORT using crc32_mpeg2             = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000>; // attested
+ZCRC_EXPORT using crc32_xfer              = crc<32, 0x000000AF, 0x00000000, false, false, 0x00000000>; // confirmed
+ZCRC_EXPORT using crc40_gsm               = crc<40, 0x0004820009, 0x0000000000, false, false, 0xFFFFFFFFFF>; // academic
+ZCRC_EXPORT using crc64_ecma_182          = crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000>; // academic
+ZCRC_EXPORT using crc64_go_iso            = crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // confirmed
+ZCRC_EXPORT using crc64_ms                = crc<64, 0x259C84CBA6426349, 0xFFFFFFFFFFFFFFFF,  true,  true, 0x0000000000000000>; // attested
+ZCRC_EXPORT using crc64_nvme              = crc<64, 0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // attested
+ZCRC_EXPORT using crc64_redis             = crc<64, 0xAD93D23594C935A9, 0x0000000000000000,  true,  true, 0x0000000000000000>; // academic
+ZCRC_EXPORT using crc64_we                = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, false, false, 0xFFFFFFFFFFFFFFFF>; // confirmed
+ZCRC_EXPORT using crc64_xz                = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // attested
+// ZCRC_EXPORT using crc82_darc = crc<82, std::bitset<82>{"0000000000110000100011000000000100010001000000010001010000000001010001000000010000010001"}, 0x0,  true,  true, >; // attested
+// clang-format on
+
+namespace detail {
+
+// NVMe's three protection information formats: 16b guard (the original T10 DIF),
+// 32b guard, and 64b guard, identified by the width of the guard tag.
+template <typename T>
+using pi_guard_t =
+    std::conditional_t<std::same_as<T, std::uint16_t>, crc16_t10_dif,
+    std::conditional_t<std::same_as<T, std::uint32_t>, crc32c,
+    std::conditional_t<std::same_as<T, std::uint64_t>, crc64_nvme,
+    void
+>>>;
+
+template <typename R>
+concept pi_tag_range =
+    std::ranges::random_access_range<R> && std::ranges::sized_range<R> &&
+    !std::is_void_v<detail::pi_guard_t<std::remove_cv_t<std::ranges::range_value_t<R>>>>;
+
+struct pi_generate_fn {
+    // Precondition: std::ranges::size(buffer) == sector_size * std::ranges::size(tags)
+    template <detail::byte_buffer R, detail::pi_tag_range T>
+    requires std::ranges::output_range<T, std::ranges::range_value_t<T>>
+    ZCRC_STATIC_CALL_OPERATOR constexpr void
+    operator()(const algorithm auto algo, R&& buffer, const std::size_t sector_size, T&& tags) ZCRC_CONST_CALL_OPERATOR {
+        detail::pi_guard_t<std::ranges::range_value_t<T>>::compute_chunked(algo, buffer, sector_size, tags);
+    }
+
+    template <detail::byte_buffer R, detail::pi_tag_range T>
+    requires std::ranges::output_range<T, std::ranges::range_value_t<T>>
+    ZCRC_STATIC_CALL_OPERATOR constexpr void
+    operator()(R&& buffer, const std::size_t sector_size, T&& tags) ZCRC_CONST_CALL_OPERATOR {
+        pi_generate_fn::operator()(default_algorithm, buffer, sector_size, tags);
+    }
+};
+
+struct pi_verify_fn {
+    // Returns the index of the first sector whose guard tag doesn't match, or
+    // std::ranges::size(tags) if they all do.
+    //
+    // Precondition: std::ranges::size(buffer) == sector_size * std::ranges::size(tags)
+    template <detail::byte_buffer R, detail::pi_tag_range T>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(const algorithm auto algo, R&& buffer, const std::size_t sector_size, T&& tags) ZCRC_CONST_CALL_OPERATOR {
+        return detail::pi_guard_t<std::remove_cv_t<std::ranges::range_value_t<T>>>::verify_chunked(algo, buffer, sector_size, tags);
+    }
+
+    template <detail::byte_buffer R, detail::pi_tag_range T>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(R&& buffer, const std::size_t sector_size, T&& tags) ZCRC_CONST_CALL_OPERATOR {
+        return pi_verify_fn::operator()(default_algorithm, buffer, sector_size, tags);
+    }
+};
+
+} // namespace detail
+
+// Storage protection information: one guard tag per fixed-size sector. The type of
+// the tags selects the format; see detail::pi_guard_t.
+namespace pi {
+
+ZCRC_EXPORT inline constexpr detail::pi_generate_fn generate {};
+ZCRC_EXPORT inline constexpr detail::pi_verify_fn verify {};
+
+} // namespace pi
+
+namespace detail {
+
+struct posix_cksum_fn {
+    // Returns the checksum that POSIX cksum prints for [r]: the CRC-32/CKSUM of [r]
+    // followed by its length in bytes, least significant byte first, stopping when
+    // the remaining bytes of the length are all zero.
+    template <std::ranges::input_range R>
+    requires std::ranges::sized_range<R> && detail::byte_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(const algorithm auto algo, R&& r) ZCRC_CONST_CALL_OPERATOR {
+        return posix_cksum_fn::operator()(
+            process(algo, crc32_cksum {}, r), static_cast<std::uint64_t>(std::ranges::size(r)));
+    }
+
+    template <std::ranges::input_range R>
+    requires std::ranges::sized_range<R> && detail::byte_like<std::ranges::range_value_t<R>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(R&& r) ZCRC_CONST_CALL_OPERATOR {
+        return posix_cksum_fn::operator()(default_algorithm, r);
+    }
+
+    // For input that arrives in pieces: [state] is crc32_cksum {} after processing
+    // all [length] bytes of it. The length takes at most 8 more bytes to fold in.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(const crc32_cksum state, std::uint64_t length) ZCRC_CONST_CALL_OPERATOR noexcept {
+        std::array<std::uint8_t, 8> suffix {};
+        std::size_t n {0};
+        for (; length != 0; length >>= 8) {
+            suffix[n++] = static_cast<std::uint8_t>(length);
+        }
+        return finalize(process(slice_by<1>, state, suffix.begin(), suffix.begin() + static_cast<std::ptrdiff_t>(n)));
+    }
+};
+
+} // namespace detail
+
+ZCRC_EXPORT inline constexpr detail::posix_cksum_fn posix_cksum {};
+
+// Arithmetic on polynomials over GF(2), for building what the library doesn't: custom
+// combining schemes, or kernels of your own.
+//
+// Polynomials modulo a CRC's P are Width-bit values in the CRC's own representation,
+// the same one process_zero_bytes and combining work in: bit i is the coefficient of
+// x^i, or of x^(Width - 1 - i) if the CRC's input is reflected. For example,
+// mulmod<C>(state, xpow<C>(8 · n)) appends n zero bytes to a C's register.
+namespace gf2 {
+
+// A polynomial of degree < 128, as gf2::clmul returns it: bit i of lo is the coefficient
+// of x^i, and bit i of hi that of x^(64 + i).
+ZCRC_EXPORT struct product {
+    std::uint64_t lo;
+    std::uint64_t hi;
+
+    friend constexpr bool operator==(product, product) = default;
+};
+
+} // namespace gf2
+
+namespace detail {
+
+struct gf2_clmul_fn {
+    // The carry-less product of [a] and [b].
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr gf2::product
+    operator()(const std::uint64_t a, const std::uint64_t b) ZCRC_CONST_CALL_OPERATOR noexcept {
+#if defined(ZCRC_CLMUL_KERNELS)
+        if (!std::is_constant_evaluated() && detail::has_clmul()) {
+            const clmul_result r {detail::clmul(a, b)};
+            return {r.lo, r.hi};
+        }
+#endif
+        gf2::product r {0, 0};
+        for (std::size_t i {0}; i < 64; ++i) {
+            if (detail::bit_is_set(b, i)) {
+                r.lo ^= a << i;
+                r.hi ^= detail::rshift(a, static_cast<std::int64_t>(64 - i));
+            }
+        }
+        return r;
+    }
+};
+
+inline constexpr gf2_clmul_fn gf2_clmul {};
+
+[[nodiscard]] constexpr gf2::product gf2_lshift(const gf2::product p, const std::size_t b) noexcept {
+    return {detail::lshift(p.lo, static_cast<std::int64_t>(b)),
+            detail::lshift(p.hi, static_cast<std::int64_t>(b)) | detail::rshift(p.lo, static_cast<std::int64_t>(64 - b))};
+}
+
+[[nodiscard]] constexpr gf2::product gf2_rshift(const gf2::product p, const std::size_t b) noexcept {
+    return {detail::rshift(p.lo, static_cast<std::int64_t>(b)) | detail::lshift(p.hi, static_cast<std::int64_t>(64 - b)),
+            detail::rshift(p.hi, static_cast<std::int64_t>(b))};
+}
+
+[[nodiscard]] constexpr gf2::product gf2_xor(const gf2::product a, const gf2::product b) noexcept {
+    return {a.lo ^ b.lo, a.hi ^ b.hi};
+}
+
+// floor(x^(2 · Width) / P), in the CRC's representation, less its x^Width term (which
+// it always has, and which wouldn't fit at Width = 64). That's long division, with the
+// dividend's bits shifted in one at a time and the quotient's coming out.
+template <typename C>
+inline constexpr typename C::crc_type gf2_barrett_constant {[] {
+    constexpr std::size_t w {C::width};
+    std::uint64_t rem {0};
+    std::uint64_t quotient {0};
+    for (std::size_t i {0}; i <= 2 * w; ++i) {
+        const bool carry {detail::bit_is_set(rem, w - 1)};
+        rem = ((rem << 1) | (i == 0 ? 1 : 0)) & detail::bottom_n_mask<std::uint64_t>(w);
+        rem ^= carry ? std::uint64_t {C::poly} : 0;
+        quotient = (quotient << 1) | (carry ? 1 : 0);
+    }
+    quotient &= detail::bottom_n_mask<std::uint64_t>(w);
+    return static_cast<typename C::crc_type>(C::refin ? detail::reflect(quotient, w) : quotient);
+}()};
+
+template <typename C>
+requires detail::is_crc<C>
+struct gf2_reduce_fn {
+    // [p] mod P. [p] must be what gf2::clmul returns for two polynomials in the CRC's
+    // representation: of degree < 2 · Width - 1, with bit i the coefficient of x^i, or
+    // of x^(2 · Width - 2 - i) if the CRC's input is reflected.
+    //
+    // This is Barrett reduction, in whichever bit order [p] is in. With the leading
+    // terms of P and the Barrett constant (see gf2_barrett_constant) added back in by
+    // hand, it's two carry-less multiplications.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr typename C::crc_type
+    operator()(const gf2::product p) ZCRC_CONST_CALL_OPERATOR noexcept {
+        constexpr std::size_t w {C::width};
+        constexpr std::uint64_t mu {detail::gf2_barrett_constant<C>};
+        if constexpr (C::refin) {
+            constexpr std::uint64_t poly {detail::reflect(std::uint64_t {C::poly}, w)};
+            const std::uint64_t h {p.lo & detail::bottom_n_mask<std::uint64_t>(w - 1)};
+            const std::uint64_t q {
+                (detail::gf2_lshift(detail::gf2_clmul(h, mu), 1).lo ^ h) & detail::bottom_n_mask<std::uint64_t>(w - 1)};
+            const gf2::product qp {detail::gf2_xor(detail::gf2_lshift(detail::gf2_clmul(q, poly), 1), {q, 0})};
+            return static_cast<typename C::crc_type>(
+                detail::gf2_rshift(detail::gf2_xor(p, qp), w - 1).lo & detail::bottom_n_mask<std::uint64_t>(w));
+        } else {
+            const std::uint64_t h {detail::gf2_rshift(p, w).lo};
+            const std::uint64_t q {h ^ detail::gf2_rshift(detail::gf2_clmul(h, mu), w).lo};
+            return static_cast<typename C::crc_type>(
+                (p.lo ^ detail::gf2_clmul(q, C::poly).lo) & detail::bottom_n_mask<std::uint64_t>(w));
+        }
+    }
+};
+
+template <typename C>
+requires detail::is_crc<C>
+struct gf2_mulmod_fn {
+    // [a] · [b] mod P.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr typename C::crc_type
+    operator()(const typename C::crc_type a, const typename C::crc_type b) ZCRC_CONST_CALL_OPERATOR noexcept {
+#if defined(ZCRC_CLMUL_KERNELS)
+        if (!std::is_constant_evaluated() && detail::has_clmul()) {
+            return gf2_reduce_fn<C> {}(detail::gf2_clmul(a, b));
+        }
+#endif
+        return detail::clmul_over_field<C::width, C::poly, C::refin>(a, b);
+    }
+};
+
+// [i] is x^(2^i) mod P.
+template <typename C>
+inline constexpr auto gf2_squares {[] {
+    constexpr std::size_t w {C::width};
+    std::array<typename C::crc_type, 64> squares {};
+    // x^1: that is, 1 · x, with the usual shift-and-subtract.
+    squares[0] = C::refin
+        ? static_cast<typename C::crc_type>(
+              (w == 1) ? detail::reflect(C::poly, w) : typename C::crc_type {1} << (w - 2))
+        : static_cast<typename C::crc_type>((w == 1) ? C::poly : 2);
+    for (std::size_t i {1}; i < squares.size(); ++i) {
+        squares[i] = detail::clmul_over_field<w, C::poly, C::refin>(squares[i - 1], squares[i - 1]);
+    }
+    return squares;
+}()};
+
+template <typename C>
+[[nodiscard]] constexpr typename C::crc_type gf2_one() noexcept {
+    return C::refin ? typename C::crc_type {1} << (C::width - 1) : typename C::crc_type {1};
+}
+
+template <typename C>
+requires detail::is_crc<C>
+struct gf2_xpow_fn {
+    // x^[n] mod P.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr typename C::crc_type
+    operator()(const std::uint64_t n) ZCRC_CONST_CALL_OPERATOR noexcept {
+        typename C::crc_type r {detail::gf2_one<C>()};
+        for (std::size_t i {0}; i < 64; ++i) {
+            if (detail::bit_is_set(n, i)) {
+                r = gf2_mulmod_fn<C> {}(r, detail::gf2_squares<C>[i]);
+            }
+        }
+        return r;
+    }
+};
+
+template <typename C>
+requires detail::is_crc<C>
+struct gf2_powmod_fn {
+    // [a]^[n] mod P.
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr typename C::crc_type
+    operator()(typename C::crc_type a, std::uint64_t n) ZCRC_CONST_CALL_OPERATOR noexcept {
+        typename C::crc_type r {detail::gf2_one<C>()};
+        for (; n != 0; n >>= 1) {
+            if ((n & 1) != 0) {
+                r = gf2_mulmod_fn<C> {}(r, a);
+            }
+            a = gf2_mulmod_fn<C> {}(a, a);
+        }
+        return r;
+    }
+};
+
+template <typename C>
+requires detail::is_crc<C>
+struct gf2_fold_constant_fn {
+    // x^[e] mod P, as a kernel folding 64-bit lanes with carry-less multiplication
+    // wants it (see fold_fn_impl): as is, or for reflected CRCs, divided by x and
+    // reflected across all 64 bits, because the product of two reflected 64-bit
+    // numbers comes out reflected across 127 bits, not 128.
+    //
+    // Precondition: e >= 1
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint64_t
+    operator()(const std::uint64_t e) ZCRC_CONST_CALL_OPERATOR noexcept {
+        if constexpr (C::refin) {
+            return std::uint64_t {gf2_xpow_fn<C> {}(e - 1)} << (64 - C::width);
+        } else {
+            return gf2_xpow_fn<C> {}(e);
+        }
+    }
+};
+
+} // namespace detail
+
+namespace gf2 {
+
+ZCRC_EXPORT inline constexpr detail::gf2_clmul_fn clmul {};
+
+ZCRC_EXPORT template <typename C>
+inline constexpr detail::gf2_reduce_fn<C> reduce {};
+
+ZCRC_EXPORT template <typename C>
+inline constexpr detail::gf2_mulmod_fn<C> mulmod {};
+
+ZCRC_EXPORT template <typename C>
+inline constexpr detail::gf2_xpow_fn<C> xpow {};
+
+ZCRC_EXPORT template <typename C>
+inline constexpr detail::gf2_powmod_fn<C> powmod {};
+
+ZCRC_EXPORT template <typename C>
+inline constexpr detail::gf2_fold_constant_fn<C> fold_constant {};
+
+ZCRC_EXPORT template <typename C>
+requires detail::is_crc<C>
+inline constexpr typename C::crc_type barrett_constant {detail::gf2_barrett_constant<C>};
+
+} // namespace gf2
+
+namespace detail {
+
+// LevelDB's masking: storing the CRC of data that itself contains CRCs invites
+// trouble, so the stored value is rotated and offset.
+inline constexpr std::uint32_t crc32c_mask_delta {0xA282'EAD8};
+
+struct mask_crc32c_fn {
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(const std::uint32_t crc) ZCRC_CONST_CALL_OPERATOR noexcept {
+        return std::rotr(crc, 15) + detail::crc32c_mask_delta;
+    }
+};
+
+struct unmask_crc32c_fn {
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(const std::uint32_t masked) ZCRC_CONST_CALL_OPERATOR noexcept {
+        return std::rotl(masked - detail::crc32c_mask_delta, 15);
+    }
+};
+
+struct compute_masked_crc32c_fn {
+    // Accepts the same arguments as crc32c::compute.
+    template <typename... Args>
+    requires std::invocable<const decltype(crc32c::compute)&, Args...>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::uint32_t
+    operator()(Args&&... args) ZCRC_CONST_CALL_OPERATOR
+        ZCRC_RETURNS(detail::mask_crc32c_fn {}(crc32c::compute(std::forward<Args>(args)...)))
+};
+
+// Batch-verifies the masked CRC32C of each record found by a parser. [records]
+// holds the offset of each record; [locate](offset) returns the {begin, end}
+// offsets of the data its CRC covers, and [stored](offset) the offset of the CRC.
+// Returns the offset of the first bad record, or [parsed_up_to] if there is none.
+template <detail::byte_buffer R, typename L, typename S>
+[[nodiscard]] constexpr std::size_t verify_masked_records(
+    const algorithm auto algo, R&& buffer, const std::vector<std::size_t>& records,
+    const std::size_t parsed_up_to, L&& locate, S&& stored
+) {
+    const auto at {[&] (const std::size_t offset) {
+        return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+    }};
+    const std::size_t bad {detail::process_batch(algo, crc32c {}, records.size(),
+        [&] (const std::size_t i) {
+            const auto [begin, end] {locate(records[i])};
+            return std::ranges::subrange {at(begin), at(end)};
+        },
+        [&] (const std::size_t i, const crc32c c) {
+            return detail::mask_crc32c_fn {}(finalize(c)) == detail::load_le<std::uint32_t>(at(stored(records[i])));
+        })};
+    return (bad == records.size()) ? parsed_up_to : records[bad];
+}
+
+struct tfrecord_verify_fn {
+    // Returns the offset of the first record in [buffer] that is truncated or fails
+    // either of its CRCs, or std::ranges::size(buffer) if there is none.
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
+
+        // Each record is:
+        //
+        //   u64le length
+        //   u32le masked CRC of length
+        //   u8    data[length]
+        //   u32le masked CRC of data
+        //
+        // The headers are too short to be worth batching, so we check them as we walk
+        // the stream, and leave the data for process_batch.
+        std::vector<std::size_t> records;
+        std::size_t offset {0};
+        while (size - offset >= 16) {
+            const auto len {detail::load_le<std::uint64_t>(at(offset))};
+            if (detail::compute_masked_crc32c_fn {}(at(offset), at(offset + 8)) != detail::load_le<std::uint32_t>(at(offset + 8)) ||
+                len > size - offset - 16) {
+                break;
+            }
+            records.push_back(offset);
+            offset += 16 + static_cast<std::size_t>(len);
+        }
+
+        const auto data_end {[&] (const std::size_t record) {
+            return record + 12 + static_cast<std::size_t>(detail::load_le<std::uint64_t>(at(record)));
+        }};
+        return detail::verify_masked_records(algo, buffer, records, offset,
+            [&] (const std::size_t record) { return std::pair {record + 12, data_end(record)}; },
+            data_end);
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return tfrecord_verify_fn::operator()(default_algorithm, buffer);
+    }
+};
+
+struct leveldb_verify_log_fn {
+    // Returns the offset of the first physical record in [buffer] that is truncated
+    // or fails its CRC, or std::ranges::size(buffer) if there is none. RocksDB's
+    // recyclable record types are understood too.
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
+
+        // The log is a sequence of 32 KiB blocks, each holding physical records:
+        //
+        //   u32le masked CRC of everything from type on
+        //   u16le length
+        //   u8    type
+        //   u32le log number (recyclable types 5 to 8 only)
+        //   u8    data[length]
+        //
+        // A record never straddles two blocks; if fewer than 7 bytes remain in a block,
+        // they're padding. A zero type and length marks preallocated space, which also
+        // runs to the end of the block.
+        constexpr std::size_t block_size {32768};
+        const auto header_size {[&] (const std::size_t record) -> std::size_t {
+            const auto type {static_cast<std::uint8_t>(at(record)[6])};
+            return (type >= 5 && type <= 8) ? 11 : 7;
+        }};
+
+        std::vector<std::size_t> records;
+        std::size_t offset {0};
+        while (offset != size) {
+            const std::size_t block_left {block_size - (offset % block_size)};
+            if (block_left < 7) {
+                offset += (std::min)(block_left, size - offset);
+                continue;
+            }
+            if (size - offset < 7) {
+                break;
+            }
+            const auto len {detail::load_le<std::uint16_t>(at(offset + 4))};
+            if (len == 0 && static_cast<std::uint8_t>(at(offset)[6]) == 0) {
+                offset += (std::min)(block_left, size - offset);
+                continue;
+            }
+            const std::size_t record_size {header_size(offset) + len};
+            if (record_size > (std::min)(block_left, size - offset)) {
+                break;
+            }
+            records.push_back(offset);
+            offset += record_size;
+        }
+
+        return detail::verify_masked_records(algo, buffer, records, offset,
+            [&] (const std::size_t record) {
+                return std::pair {record + 6, record + header_size(record) + detail::load_le<std::uint16_t>(at(record + 4))};
+            },
+            [] (const std::size_t record) { return record; });
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::size_t
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return leveldb_verify_log_fn::operator()(default_algorithm, buffer);
+    }
+};
+
+} // namespace detail
+
+// The "masked" CRC32C used by LevelDB, RocksDB, TFRecord, and the Snappy framing format.
+namespace masked_crc32c {
+
+ZCRC_EXPORT inline constexpr detail::mask_crc32c_fn mask {};
+ZCRC_EXPORT inline constexpr detail::unmask_crc32c_fn unmask {};
+ZCRC_EXPORT inline constexpr detail::compute_masked_crc32c_fn compute {};
+
+} // namespace masked_crc32c
+
+namespace tfrecord {
+
+ZCRC_EXPORT inline constexpr detail::tfrecord_verify_fn verify {};
+
+} // namespace tfrecord
+
+namespace leveldb {
+
+ZCRC_EXPORT inline constexpr detail::leveldb_verify_log_fn verify_log {};
+
+} // namespace leveldb
+
+namespace detail {
+
+// Checks the CRC of each of [count] regions of [buffer], where [locate](i) returns
+// the {begin, end} offsets of region i and [expected](i) its CRC. Returns a flag
+// per region, set if it's bad. (Not std::vector<bool>: with zcrc::parallel, the
+// flags are written concurrently.)
+template <typename CRC, detail::byte_buffer R, typename L, typename E>
+[[nodiscard]] constexpr std::vector<std::uint8_t> find_bad_regions(
+    const algorithm auto algo, R&& buffer, const std::size_t count, L&& locate, E&& expected
+) {
+    const auto at {[&] (const std::size_t offset) {
+        return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+    }};
+    std::vector<std::uint8_t> bad(count);
+    (void)detail::process_batch(algo, CRC {}, count,
+        [&] (const std::size_t i) {
+            const auto [begin, end] {locate(i)};
+            return std::ranges::subrange {at(begin), at(end)};
+        },
+        [&] (const std::size_t i, const CRC c) {
+            bad[i] = finalize(c) != expected(i);
+            return true;
+        });
+    return bad;
+}
+
+// Does nothing with the pieces it's given; used only to define the inflater concept.
+struct inflate_output_archetype {
+    void operator()(std::span<const unsigned char>) const;
+};
+
+} // namespace detail
+
+// An inflater decompresses the raw deflate stream at the start of [in], calls
+// [out] with each piece of output in order, and returns how many bytes of [in]
+// the stream occupied, or std::nullopt if it's corrupt. See <zcrc/zlib.hpp>.
+ZCRC_EXPORT template <typename T>
+concept inflater = requires (const T& inflate, std::span<const unsigned char> in, detail::inflate_output_archetype& out) {
+    { inflate(in, out) } -> std::same_as<std::optional<std::size_t>>;
+};
+
+namespace detail {
+
+// Inflates the raw deflate stream at the start of [in] with [inflate], folding the
+// output into a CRC-32 as it's produced. Returns {bytes consumed, CRC, bytes produced},
+// or std::nullopt if the stream is corrupt.
+template <zcrc::inflater F>
+[[nodiscard]] std::optional<std::tuple<std::size_t, std::uint32_t, std::uint64_t>>
+inflate_crc32(const algorithm auto algo, const F& inflate, const std::span<const unsigned char> in) {
+    crc32_iso_hdlc state {};
+    std::uint64_t produced {0};
+    const std::optional<std::size_t> consumed {inflate(in, [&] (const std::span<const unsigned char> piece) {
+        state = process(algo, state, piece);
+        produced += piece.size();
+    })};
+    if (!consumed) {
+        return std::nullopt;
+    }
+    return std::tuple {*consumed, finalize(state), produced};
+}
+
+struct png_verify_fn {
+    // Returns the offset of every chunk in [buffer] whose CRC doesn't match, in order.
+    // If the signature is missing or a chunk is truncated, the offset at which parsing
+    // stopped is reported last.
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
+
+        constexpr std::array<std::uint8_t, 8> signature {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        for (std::size_t i {0}; i < signature.size(); ++i) {
+            if (i == size || static_cast<std::uint8_t>(*at(i)) != signature[i]) {
+                return {0};
+            }
+        }
+
+        // Each chunk is:
+        //
+        //   u32be length
+        //   u8    type[4]
+        //   u8    data[length]
+        //   u32be CRC-32 of type and data
+        //
+        // The stream ends with an IEND chunk; anything after it is ignored.
+        std::vector<std::size_t> chunks;
+        std::size_t offset {signature.size()};
+        bool truncated {false};
+        while (true) {
+            if (size - offset < 12 || detail::load_be<std::uint32_t>(at(offset)) > size - offset - 12) {
+                truncated = true;
+                break;
+            }
+            chunks.push_back(offset);
+            const bool iend {detail::load_be<std::uint32_t>(at(offset + 4)) == 0x49454E44};
+            offset += 12 + detail::load_be<std::uint32_t>(at(offset));
+            if (iend) {
+                break;
+            }
+        }
+
+        const auto data_end {[&] (const std::size_t i) {
+            return chunks[i] + 8 + detail::load_be<std::uint32_t>(at(chunks[i]));
+        }};
+        const std::vector<std::uint8_t> bad {detail::find_bad_regions<crc32_iso_hdlc>(algo, buffer, chunks.size(),
+            [&] (const std::size_t i) { return std::pair {chunks[i] + 4, data_end(i)}; },
+            [&] (const std::size_t i) { return detail::load_be<std::uint32_t>(at(data_end(i))); })};
+
+        std::vector<std::size_t> result;
+        for (std::size_t i {0}; i < chunks.size(); ++i) {
+            if (bad[i]) {
+                result.push_back(chunks[i]);
+            }
+        }
+        if (truncated) {
+            result.push_back(offset);
+        }
+        return result;
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return png_verify_fn::operator()(default_algorithm, buffer);
+    }
+};
+
+struct zip_verify_fn {
+    // Returns the local header offset of every entry in [buffer] that is corrupt, in
+    // central directory order. Stored entries are always checked, deflated entries
+    // only if given an inflater, and entries with other compression methods never.
+    // If the central directory can't be parsed, the offset at which parsing stopped
+    // (the end of the buffer, if there's no end of central directory record) is
+    // reported last.
+    template <detail::byte_buffer R, zcrc::inflater F>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer, const F& inflate) ZCRC_CONST_CALL_OPERATOR {
+        return zip_verify_fn::verify(algo, buffer, &inflate);
+    }
+
+    template <detail::byte_buffer R, zcrc::inflater F>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(R&& buffer, const F& inflate) ZCRC_CONST_CALL_OPERATOR {
+        return zip_verify_fn::verify(default_algorithm, buffer, &inflate);
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return zip_verify_fn::verify(algo, buffer, static_cast<const no_inflater *>(nullptr));
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return zip_verify_fn::verify(default_algorithm, buffer, static_cast<const no_inflater *>(nullptr));
+    }
+
+private:
+    struct no_inflater {
+        std::optional<std::size_t> operator()(std::span<const unsigned char>, auto&&) const { return std::nullopt; }
+    };
+
+    struct entry {
+        std::size_t header;
+        std::size_t data;
+        std::uint64_t compressed_size;
+        std::uint64_t uncompressed_size;
+        std::uint32_t crc;
+        std::uint16_t method;
+        bool malformed;
+    };
+
+    template <typename R, typename F>
+    [[nodiscard]] static std::vector<std::size_t> verify(const algorithm auto algo, R&& buffer, const F * const inflate) {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto bytes {reinterpret_cast<const unsigned char *>(std::ranges::data(buffer))};
+        const auto u16 {[&] (const std::size_t offset) { return detail::load_le<std::uint16_t>(bytes + offset); }};
+        const auto u32 {[&] (const std::size_t offset) { return detail::load_le<std::uint32_t>(bytes + offset); }};
+        const auto u64 {[&] (const std::size_t offset) { return detail::load_le<std::uint64_t>(bytes + offset); }};
+
+        // Find the end of central directory record. It's the last thing in the file,
+        // but may be followed by a comment of up to 65535 bytes.
+        std::size_t eocd {size};
+        for (std::size_t i {size < 22 ? 0 : size - 22 + 1}; i-- > (size < 22 + 0xFFFF ? 0 : size - 22 - 0xFFFF);) {
+            if (u32(i) == 0x06054B50) {
+                eocd = i;
+                break;
+            }
+        }
+        if (eocd == size) {
+            return {size};
+        }
+
+        std::uint64_t entry_count {u16(eocd + 10)};
+        std::uint64_t directory {u32(eocd + 16)};
+        // Zip64 moves these to another record, found via a locator just before this one.
+        if ((entry_count == 0xFFFF || directory == 0xFFFF'FFFF) && eocd >= 20 && u32(eocd - 20) == 0x07064B50) {
+            const std::uint64_t eocd64 {u64(eocd - 20 + 8)};
+            if (size < 56 || eocd64 > size - 56 || u32(static_cast<std::size_t>(eocd64)) != 0x06064B50) {
+                return {eocd};
+            }
+            entry_count = u64(static_cast<std::size_t>(eocd64) + 32);
+            directory = u64(static_cast<std::size_t>(eocd64) + 48);
+        }
+        if (directory > size) {
+            return {eocd};
+        }
+        auto offset {static_cast<std::size_t>(directory)};
+
+        std::vector<entry> entries;
+        std::optional<std::size_t> truncated;
+        for (std::uint64_t i {0}; i < entry_count; ++i) {
+            if (size < 46 || offset > size - 46 || u32(offset) != 0x02014B50 ||
+                46 + std::uint64_t {u16(offset + 28)} + u16(offset + 30) + u16(offset + 32) > size - offset) {
+                truncated = offset;
+                break;
+            }
+            entry e {0, 0, u32(offset + 20), u32(offset + 24), u32(offset + 16), u16(offset + 10), true};
+            std::uint64_t header {u32(offset + 42)};
+
+            // The Zip64 extended information field holds whichever of the sizes and
+            // offset didn't fit, in that order.
+            const std::size_t extra {offset + 46 + u16(offset + 28)};
+            const std::size_t extra_end {extra + u16(offset + 30)};
+            for (std::size_t field {extra}; field + 4 <= extra_end;) {
+                const std::size_t field_end {(std::min)(field + 4 + u16(field + 2), extra_end)};
+                if (u16(field) == 0x0001) {
+                    std::size_t value {field + 4};
+                    for (std::uint64_t * const v : {&e.uncompressed_size, &e.compressed_size, &header}) {
+                        if (*v == 0xFFFF'FFFF && value + 8 <= field_end) {
+                            *v = u64(value);
+                            value += 8;
+                        }
+                    }
+                }
+                field = field_end;
+            }
+            offset = extra_end + u16(offset + 32);
+
+            // The local header repeats most of the central directory's information,
+            // but its name and extra field may differ in length.
+            e.header = static_cast<std::size_t>(header);
+            if (size >= 30 && header <= size - 30 && u32(e.header) == 0x04034B50) {
+                e.data = e.header + 30 + u16(e.header + 26) + u16(e.header + 28);
+                e.malformed = e.data > size || e.compressed_size > size - e.data ||
+                    (e.method == 0 && e.compressed_size != e.uncompressed_size);
+            }
+            entries.push_back(e);
+        }
+
+        // Stored entries are checked together, like chunks; deflated ones each go
+        // through the inflater, concurrently if we're asked to parallelize.
+        std::vector<std::size_t> stored;
+        std::vector<std::size_t> deflated;
+        for (std::size_t i {0}; i < entries.size(); ++i) {
+            if (entries[i].malformed) {
+                continue;
+            }
+            if (entries[i].method == 0) {
+                stored.push_back(i);
+            } else if (entries[i].method == 8 && inflate != nullptr) {
+                deflated.push_back(i);
+            }
+        }
+
+        std::vector<std::uint8_t> bad(entries.size());
+        const std::vector<std::uint8_t> bad_stored {detail::find_bad_regions<crc32_iso_hdlc>(algo, buffer, stored.size(),
+            [&] (const std::size_t i) { return std::pair {entries[stored[i]].data, entries[stored[i]].data + entries[stored[i]].compressed_size}; },
+            [&] (const std::size_t i) { return entries[stored[i]].crc; })};
+        for (std::size_t i {0}; i < stored.size(); ++i) {
+            bad[stored[i]] = bad_stored[i];
+        }
+
+        const auto check_deflated {[&] (const std::size_t i) {
+            const entry& e {entries[i]};
+            const auto r {detail::inflate_crc32(detail::sequential(algo), *inflate,
+                std::span {bytes + e.data, static_cast<std::size_t>(e.compressed_size)})};
+            bad[i] = !r || std::get<1>(*r) != e.crc || std::get<2>(*r) != e.uncompressed_size;
+        }};
+#if defined(__cpp_lib_parallel_algorithm) && __cpp_lib_parallel_algorithm >= 201603L
+        if constexpr (detail::is_parallel<std::remove_cvref_t<decltype(algo)>>) {
+            const auto indices {std::views::iota(std::size_t {0}, deflated.size())};
+            std::for_each(std::execution::par, std::ranges::begin(indices), std::ranges::end(indices),
+                [&] (const std::size_t i) { check_deflated(deflated[i]); });
+        } else
+#endif
+        {
+            for (const std::size_t i : deflated) {
+                check_deflated(i);
+            }
+        }
+
+        std::vector<std::size_t> result;
+        for (std::size_t i {0}; i < entries.size(); ++i) {
+            if (entries[i].malformed || bad[i]) {
+                result.push_back(entries[i].header);
+            }
+        }
+        if (truncated) {
+            result.push_back(*truncated);
+        }
+        return result;
+    }
+};
+
+struct gzip_verify_fn {
+    // Returns the offset of every member of [buffer] whose header CRC, data CRC, or
+    // length doesn't match, in order. Since the end of a member can only be found by
+    // inflating it, a member that's truncated or fails to inflate ends the search;
+    // its offset is reported last.
+    template <detail::byte_buffer R, zcrc::inflater F>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer, const F& inflate) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto bytes {reinterpret_cast<const unsigned char *>(std::ranges::data(buffer))};
+
+        std::vector<std::size_t> result;
+        for (std::size_t member {0}; member != size;) {
+            // The header is:
+            //
+            //   u8    ID1 (0x1F), ID2 (0x8B), CM (8, deflate), FLG
+            //   u32le MTIME
+            //   u8    XFL, OS
+            //   if FLG.FEXTRA:   u16le XLEN, u8 extra[XLEN]
+            //   if FLG.FNAME:    zero-terminated name
+            //   if FLG.FCOMMENT: zero-terminated comment
+            //   if FLG.FHCRC:    u16le low half of the CRC-32 of the header so far
+            //
+            // and the trailer, after the deflate stream, is:
+            //
+            //   u32le CRC-32 of the uncompressed data
+            //   u32le ISIZE, the length of the uncompressed data mod 2^32
+            std::size_t offset {member + 10};
+            const auto skip_string {[&] {
+                while (offset < size && bytes[offset] != 0) {
+                    ++offset;
+                }
+                ++offset;
+            }};
+            if (size - member < 18 || bytes[member] != 0x1F || bytes[member + 1] != 0x8B || bytes[member + 2] != 8) {
+                result.push_back(member);
+                break;
+            }
+            const std::uint8_t flags {bytes[member + 3]};
+            if ((flags & 0x04) != 0) {
+                offset += 2 + detail::load_le<std::uint16_t>(bytes + offset);
+            }
+            if ((flags & 0x08) != 0 && offset < size) {
+                skip_string();
+            }
+            if ((flags & 0x10) != 0 && offset < size) {
+                skip_string();
+            }
+            bool bad {false};
+            if ((flags & 0x02) != 0) {
+                if (offset + 2 <= size) {
+                    bad = static_cast<std::uint16_t>(crc32_iso_hdlc::compute(bytes + member, bytes + offset)) !=
+                        detail::load_le<std::uint16_t>(bytes + offset);
+                }
+                offset += 2;
+            }
+            if (offset > size) {
+                result.push_back(member);
+                break;
+            }
+
+            // Members are inflated one after another, and the inflater hands back a window
+            // at a time, too little to split across threads.
+            const auto r {detail::inflate_crc32(detail::sequential(algo), inflate, std::span {bytes + offset, size - offset})};
+            if (!r || size - offset - std::get<0>(*r) < 8) {
+                result.push_back(member);
+                break;
+            }
+            offset += std::get<0>(*r);
+            if (bad || std::get<1>(*r) != detail::load_le<std::uint32_t>(bytes + offset) ||
+                static_cast<std::uint32_t>(std::get<2>(*r)) != detail::load_le<std::uint32_t>(bytes + offset + 4)) {
+                result.push_back(member);
+            }
+            member = offset + 8;
+        }
+        return result;
+    }
+
+    template <detail::byte_buffer R, zcrc::inflater F>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR std::vector<std::size_t>
+    operator()(R&& buffer, const F& inflate) ZCRC_CONST_CALL_OPERATOR {
+        return gzip_verify_fn::operator()(default_algorithm, buffer, inflate);
+    }
+};
+
+// Just enough of Thrift's compact protocol to read Parquet's metadata: values are
+// read or skipped by type, and anything malformed, including running past [end],
+// sets [failed] (after which every read returns 0, so loops over the input stop).
+template <std::random_access_iterator I>
+struct thrift_compact_reader {
+    I base;
+    std::size_t offset;
+    std::size_t end;
+    bool failed {false};
+
+    // Types as they appear in field and list headers.
+    static constexpr std::uint8_t bool_true {1};
+    static constexpr std::uint8_t bool_false {2};
+    static constexpr std::uint8_t i32 {5};
+    static constexpr std::uint8_t i64 {6};
+    static constexpr std::uint8_t binary {8};
+    static constexpr std::uint8_t list_ {9};
+    static constexpr std::uint8_t struct_ {12};
+
+    constexpr std::uint8_t byte() noexcept {
+        if (offset >= end) {
+            failed = true;
+            return 0;
+        }
+        return static_cast<std::uint8_t>(base[static_cast<std::iter_difference_t<I>>(offset++)]);
+    }
+
+    constexpr void advance(const std::uint64_t n) noexcept {
+        if (n > end - offset) {
+            failed = true;
+            offset = end;
+        } else {
+            offset += static_cast<std::size_t>(n);
+        }
+    }
+
+    constexpr std::uint64_t varint() noexcept {
+        std::uint64_t r {0};
+        for (std::size_t shift {0}; shift < 64; shift += 7) {
+            const std::uint8_t b {byte()};
+            r |= std::uint64_t {b & 0x7FU} << shift;
+            if ((b & 0x80) == 0) {
+                return r;
+            }
+        }
+        failed = true;
+        return 0;
+    }
+
+    // i16, i32, and i64 are all zigzag varints.
+    constexpr std::int64_t integer() noexcept {
+        const std::uint64_t n {varint()};
+        return static_cast<std::int64_t>(n >> 1) ^ -static_cast<std::int64_t>(n & 1);
+    }
+
+    // Calls [f](id, type) for each field of a struct; [f] must consume the value.
+    template <typename F>
+    constexpr void fields(F&& f) {
+        std::int64_t id {0};
+        while (true) {
+            const std::uint8_t header {byte()};
+            if (header == 0) {
+                return;
+            }
+            id = ((header >> 4) != 0) ? id + (header >> 4) : integer();
+            f(id, static_cast<std::uint8_t>(header & 0x0F));
+        }
+    }
+
+    // Calls [f](type) for each element of a list or set; [f] must consume the element.
+    // Every element takes at least a byte, so a size past [end] is malformed.
+    template <typename F>
+    constexpr void elements(F&& f) {
+        const std::uint8_t header {byte()};
+        std::uint64_t size {static_cast<std::uint64_t>(header >> 4)};
+        if (size == 15) {
+            size = varint();
+        }
+        if (size > end - offset) {
+            failed = true;
+            offset = end;
+            return;
+        }
+        for (; size != 0 && !failed; --size) {
+            f(static_cast<std::uint8_t>(header & 0x0F));
+        }
+    }
 
-        template <std::input_iterator I, std::sentinel_for<I> S>
-        requires detail::byte_like<std::iter_value_t<I>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
-        operator()(I begin, S end) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(compute_member_fn::operator()(default_algorithm, std::move(begin), std::move(end)))
+    constexpr void skip(const std::uint8_t type, const std::size_t depth = 0) {
+        if (depth == 64) {
+            failed = true;
+            return;
+        }
+        // Booleans are folded into the type of a field, but take a byte as elements.
+        const auto skip_element {[&] (const std::uint8_t t) {
+            if (t == bool_true || t == bool_false) {
+                (void)byte();
+            } else {
+                skip(t, depth + 1);
+            }
+        }};
+        switch (type) {
+        case bool_true:
+        case bool_false:
+            return;
+        case 3:
+            (void)byte();
+            return;
+        case 4:
+        case i32:
+        case i64:
+            (void)varint();
+            return;
+        case 7:
+            advance(8);
+            return;
+        case binary:
+            advance(varint());
+            return;
+        case list_:
+        case 10:
+            elements(skip_element);
+            return;
+        case 11:
+            if (std::uint64_t size {varint()}; size != 0) {
+                const std::uint8_t types {byte()};
+                if (size > (end - offset) / 2) {
+                    failed = true;
+                    offset = end;
+                    return;
+                }
+                for (; size != 0 && !failed; --size) {
+                    skip_element(static_cast<std::uint8_t>(types >> 4));
+                    skip_element(static_cast<std::uint8_t>(types & 0x0F));
+                }
+            }
+            return;
+        case struct_:
+            fields([&] (std::int64_t, const std::uint8_t t) { skip(t, depth + 1); });
+            return;
+        default:
+            failed = true;
+        }
+    }
+};
 
-        template <std::ranges::input_range R>
-        requires detail::byte_like<std::ranges::range_value_t<R>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr crc_type
-        operator()(R&& r) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(compute_member_fn::operator()(default_algorithm, std::ranges::begin(r), std::ranges::end(r)))
-    };
+struct parquet_verify_fn {
+    // Returns the offset of the header of every page in [buffer] whose CRC doesn't
+    // match, in order; pages without one are skipped. The column chunks are found
+    // in the footer, or given as [chunks], (offset, length) pairs. Wherever a page
+    // header or the footer can't be parsed, the offset at which parsing stopped is
+    // reported too. Encrypted files aren't understood.
+    template <detail::byte_buffer R, std::ranges::input_range C>
+    requires detail::byte_extent<std::ranges::range_value_t<C>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer, C&& chunks) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
 
-    struct is_valid_member_fn {
-        template <std::input_iterator I, std::sentinel_for<I> S>
-        requires detail::byte_like<std::iter_value_t<I>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
-        operator()(const algorithm auto algo, I begin, S end) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(::zcrc::is_valid(process(algo, crc {}, std::move(begin), std::move(end))))
+        // A column chunk is a run of pages, each a PageHeader struct followed by
+        // compressed_page_size bytes, which the page's CRC-32 (if any) covers:
+        //
+        //   struct PageHeader {
+        //     1: required i32 type
+        //     2: required i32 uncompressed_page_size
+        //     3: required i32 compressed_page_size
+        //     4: optional i32 crc
+        //     ...
+        //   }
+        struct page {
+            std::size_t header;
+            std::size_t begin;
+            std::size_t end;
+            std::uint32_t crc;
+        };
+        std::vector<page> pages;
+        std::vector<std::size_t> result;
+        for (auto&& chunk : chunks) {
+            const auto begin {static_cast<std::uint64_t>(std::get<0>(chunk))};
+            const auto length {static_cast<std::uint64_t>(std::get<1>(chunk))};
+            if (begin > size || length > size - begin) {
+                result.push_back(static_cast<std::size_t>((std::min<std::uint64_t>)(begin, size)));
+                continue;
+            }
+            const auto chunk_end {static_cast<std::size_t>(begin + length)};
+            for (auto offset {static_cast<std::size_t>(begin)}; offset != chunk_end;) {
+                detail::thrift_compact_reader reader {at(0), offset, chunk_end};
+                std::int64_t compressed {-1};
+                std::optional<std::uint32_t> crc;
+                reader.fields([&] (const std::int64_t id, const std::uint8_t type) {
+                    if (id == 3 && type == reader.i32) {
+                        compressed = reader.integer();
+                    } else if (id == 4 && type == reader.i32) {
+                        crc = static_cast<std::uint32_t>(reader.integer());
+                    } else {
+                        reader.skip(type);
+                    }
+                });
+                if (reader.failed || compressed < 0 || static_cast<std::uint64_t>(compressed) > chunk_end - reader.offset) {
+                    result.push_back(offset);
+                    break;
+                }
+                const std::size_t data_end {reader.offset + static_cast<std::size_t>(compressed)};
+                if (crc) {
+                    pages.push_back({offset, reader.offset, data_end, *crc});
+                }
+                offset = data_end;
+            }
+        }
 
-        template <std::ranges::input_range R>
-        requires detail::byte_like<std::ranges::range_value_t<R>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
-        operator()(const algorithm auto algo, R&& r) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(is_valid_member_fn::operator()(algo, std::ranges::begin(r), std::ranges::end(r)))
+        // Pages are usually small enough to batch, but the odd large one (a dictionary,
+        // say) is better checked alone, so that with zcrc::parallel it's split across
+        // threads rather than keeping one busy.
+        constexpr std::size_t large_page {std::size_t {1} << 22};
+        const auto large {std::ranges::partition(pages, [] (const page& p) { return p.end - p.begin < large_page; })};
+        const auto batched {static_cast<std::size_t>(large.begin() - pages.begin())};
+        const std::vector<std::uint8_t> bad {detail::find_bad_regions<crc32_iso_hdlc>(algo, buffer, batched,
+            [&] (const std::size_t i) { return std::pair {pages[i].begin, pages[i].end}; },
+            [&] (const std::size_t i) { return pages[i].crc; })};
+        for (std::size_t i {0}; i < pages.size(); ++i) {
+            if ((i < batched) ? bad[i] : (crc32_iso_hdlc::compute(algo, at(pages[i].begin), at(pages[i].end)) != pages[i].crc)) {
+                result.push_back(pages[i].header);
+            }
+        }
+        std::ranges::sort(result);
+        return result;
+    }
 
-        template <std::input_iterator I, std::sentinel_for<I> S>
-        requires detail::byte_like<std::iter_value_t<I>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
-        operator()(I begin, S end) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(is_valid_member_fn::operator()(default_algorithm, std::move(begin), std::move(end)))
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
 
-        template <std::ranges::input_range R>
-        requires detail::byte_like<std::ranges::range_value_t<R>>
-        [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr bool
-        operator()(R&& r) ZCRC_CONST_CALL_OPERATOR
-            ZCRC_RETURNS(is_valid_member_fn::operator()(default_algorithm, std::ranges::begin(r), std::ranges::end(r)))
-    };
+        // The file is:
+        //
+        //   u8    magic[4] ("PAR1")
+        //         column chunks
+        //         FileMetaData
+        //   u32le length of FileMetaData
+        //   u8    magic[4] ("PAR1")
+        //
+        // and we need, of the metadata:
+        //
+        //   struct FileMetaData { 4: required list<RowGroup> row_groups; ... }
+        //   struct RowGroup { 1: required list<ColumnChunk> columns; ... }
+        //   struct ColumnChunk {
+        //     1: optional string file_path          (the chunk is in another file)
+        //     3: optional ColumnMetaData meta_data
+        //     ...
+        //   }
+        //   struct ColumnMetaData {
+        //     7:  required i64 total_compressed_size
+        //     9:  required i64 data_page_offset
+        //     11: optional i64 dictionary_page_offset
+        //     ...
+        //   }
+        const auto is_magic {[&] (const std::size_t offset) {
+            return detail::load_le<std::uint32_t>(at(offset)) == 0x3152'4150;
+        }};
+        if (size < 12 || !is_magic(0) || !is_magic(size - 4)) {
+            return {0};
+        }
+        const std::uint32_t footer_size {detail::load_le<std::uint32_t>(at(size - 8))};
+        if (footer_size > size - 12) {
+            return {size - 8};
+        }
+        const std::size_t footer {size - 8 - footer_size};
 
-public:
-    static_assert(Width != 0);
-    static_assert(std::numeric_limits<crc_type>::digits >= Width);
-    static_assert((Poly & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
-    static_assert((Init & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
-    static_assert((XOROut & ~detail::bottom_n_mask<crc_type>(Width)) == 0);
+        std::vector<std::pair<std::size_t, std::size_t>> chunks;
+        detail::thrift_compact_reader reader {at(0), footer, size - 8};
+        const auto struct_of {[&] (const std::uint8_t type, auto&& f) {
+            if (type == reader.struct_) {
+                reader.fields(f);
+            } else {
+                reader.skip(type);
+            }
+        }};
+        const auto list_of {[&] (const std::uint8_t type, auto&& f) {
+            if (type == reader.list_) {
+                // Unlike fields, boolean elements take a byte, which [f]'s fallback wouldn't consume.
+                reader.elements([&] (const std::uint8_t t) {
+                    if (t == reader.bool_true || t == reader.bool_false) {
+                        (void)reader.byte();
+                    } else {
+                        f(t);
+                    }
+                });
+            } else {
+                reader.skip(type);
+            }
+        }};
+        const auto column_chunk {[&] (const std::uint8_t type) {
+            bool elsewhere {false};
+            std::int64_t total_size {-1};
+            std::int64_t data_page {-1};
+            std::int64_t dictionary_page {-1};
+            struct_of(type, [&] (const std::int64_t id, const std::uint8_t field_type) {
+                if (id == 1) {
+                    elsewhere = true;
+                    reader.skip(field_type);
+                } else if (id == 3) {
+                    struct_of(field_type, [&] (const std::int64_t meta_id, const std::uint8_t meta_type) {
+                        if (meta_type == reader.i64 && (meta_id == 7 || meta_id == 9 || meta_id == 11)) {
+                            (meta_id == 7 ? total_size : meta_id == 9 ? data_page : dictionary_page) = reader.integer();
+                        } else {
+                            reader.skip(meta_type);
+                        }
+                    });
+                } else {
+                    reader.skip(field_type);
+                }
+            });
+            // Some writers store a dictionary_page_offset of 0 when there's no dictionary.
+            const std::int64_t first {(dictionary_page > 0 && dictionary_page < data_page) ? dictionary_page : data_page};
+            if (!elsewhere && first >= 0 && total_size >= 0) {
+                chunks.emplace_back(static_cast<std::size_t>(first), static_cast<std::size_t>(total_size));
+            }
+        }};
+        reader.fields([&] (const std::int64_t id, const std::uint8_t type) {
+            if (id != 4) {
+                reader.skip(type);
+                return;
+            }
+            list_of(type, [&] (const std::uint8_t row_group_type) {
+                struct_of(row_group_type, [&] (const std::int64_t row_group_id, const std::uint8_t field_type) {
+                    if (row_group_id == 1) {
+                        list_of(field_type, column_chunk);
+                    } else {
+                        reader.skip(field_type);
+                    }
+                });
+            });
+        });
+        if (reader.failed) {
+            return {footer};
+        }
+        return parquet_verify_fn::operator()(algo, buffer, chunks);
+    }
 
-    static constexpr std::size_t width {Width};
-    static constexpr crc_type poly {Poly};
-    static constexpr crc_type init {Init};
-    static constexpr bool refin {RefIn};
-    static constexpr bool refout {RefOut};
-    static constexpr crc_type xorout {XOROut};
+    template <detail::byte_buffer R, std::ranges::input_range C>
+    requires detail::byte_extent<std::ranges::range_value_t<C>>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(R&& buffer, C&& chunks) ZCRC_CONST_CALL_OPERATOR {
+        return parquet_verify_fn::operator()(default_algorithm, buffer, chunks);
+    }
 
-    [[nodiscard]] constexpr crc() noexcept = default;
-    [[nodiscard]] explicit constexpr crc(zero_init_t) noexcept : m_crc {0} {}
-    [[nodiscard]] friend constexpr bool operator==(crc, crc) noexcept = default;
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<std::size_t>
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return parquet_verify_fn::operator()(default_algorithm, buffer);
+    }
+};
 
-    static constexpr compute_member_fn compute {};
-    static constexpr is_valid_member_fn is_valid {};
+} // namespace detail
+
+namespace kafka {
+
+// A record batch found by zcrc::kafka::verify: where it starts in the buffer, how
+// long it is, and whether its CRC matches.
+ZCRC_EXPORT struct batch {
+    std::size_t offset;
+    std::size_t size;
+    bool intact;
+
+    friend constexpr bool operator==(const batch&, const batch&) = default;
 };
 
-// clang-format off
+} // namespace kafka
 
-ZCRC_EXPORT using crc3_gsm                = crc<3,      0x3,      0x0, false, false,      0x7>; // academic
-ZCRC_EXPORT using crc3_rohc               = crc<3,      0x3,      0x7,  true,  true,      0x0>; // academic
-ZCRC_EXPORT using crc4_g_704              = crc<4,      0x3,      0x0,  true,  true,      0x0>; // academic
-ZCRC_EXPORT using crc4_interlaken         = crc<4,      0x3,      0xF, false, false,      0xF>; // academic
-ZCRC_EXPORT using crc5_epc_c1g2           = crc<5,     0x09,     0x09, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc5_g_704              = crc<5,     0x15,     0x00,  true,  true,     0x00>; // academic
-ZCRC_EXPORT using crc5_usb                = crc<5,     0x05,     0x1F,  true,  true,     0x1F>; // confirmed
-ZCRC_EXPORT using crc6_cdma2000_a         = crc<6,     0x27,     0x3F, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc6_cdma2000_b         = crc<6,     0x07,     0x3F, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc6_darc               = crc<6,     0x19,     0x00,  true,  true,     0x00>; // attested
-ZCRC_EXPORT using crc6_g_704              = crc<6,     0x03,     0x00,  true,  true,     0x00>; // academic
-ZCRC_EXPORT using crc6_gsm                = crc<6,     0x2F,     0x00, false, false,     0x3F>; // academic
-ZCRC_EXPORT using crc7_mmc                = crc<7,     0x09,     0x00, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc7_rohc               = crc<7,     0x4F,     0x7F,  true,  true,     0x00>; // academic
-ZCRC_EXPORT using crc7_umts               = crc<7,     0x45,     0x00, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc8_autosar            = crc<8,     0x2F,     0xFF, false, false,     0xFF>; // attested
-ZCRC_EXPORT using crc8_bluetooth          = crc<8,     0xA7,     0x00,  true,  true,     0x00>; // attested
-ZCRC_EXPORT using crc8_cdma2000           = crc<8,     0x9B,     0xFF, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc8_darc               = crc<8,     0x39,     0x00,  true,  true,     0x00>; // attested
-ZCRC_EXPORT using crc8_dvb_s2             = crc<8,     0xD5,     0x00, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc8_gsm_a              = crc<8,     0x1D,     0x00, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc8_gsm_b              = crc<8,     0x49,     0x00, false, false,     0xFF>; // academic
-ZCRC_EXPORT using crc8_hitag              = crc<8,     0x1D,     0xFF, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_i_432_1            = crc<8,     0x07,     0x00, false, false,     0x55>; // academic
-ZCRC_EXPORT using crc8_i_code             = crc<8,     0x1D,     0xFD, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_lte                = crc<8,     0x9B,     0x00, false, false,     0x00>; // academic
-ZCRC_EXPORT using crc8_maxim_dow          = crc<8,     0x31,     0x00,  true,  true,     0x00>; // attested
-ZCRC_EXPORT using crc8_mifare_mad         = crc<8,     0x1D,     0xC7, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_nrsc_5             = crc<8,     0x31,     0xFF, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_opensafety         = crc<8,     0x2F,     0x00, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_rohc               = crc<8,     0x07,     0xFF,  true,  true,     0x00>; // academic
-ZCRC_EXPORT using crc8_sae_j1850          = crc<8,     0x1D,     0xFF, false, false,     0xFF>; // attested
-ZCRC_EXPORT using crc8_smbus              = crc<8,     0x07,     0x00, false, false,     0x00>; // attested
-ZCRC_EXPORT using crc8_tech_3250          = crc<8,     0x1D,     0xFF,  true,  true,     0x00>; // attested
-ZCRC_EXPORT using crc8_wcdma              = crc<8,     0x9B,     0x00,  true,  true,     0x00>; // third_party
-ZCRC_EXPORT using crc10_atm               = crc<10,    0x233,    0x000, false, false,    0x000>; // attested
-ZCRC_EXPORT using crc10_cdma2000          = crc<10,    0x3D9,    0x3FF, false, false,    0x000>; // academic
-ZCRC_EXPORT using crc10_gsm               = crc<10,    0x175,    0x000, false, false,    0x3FF>; // academic
-ZCRC_EXPORT using crc11_flexray           = crc<11,    0x385,    0x01A, false, false,    0x000>; // attested
-ZCRC_EXPORT using crc11_umts              = crc<11,    0x307,    0x000, false, false,    0x000>; // academic
-ZCRC_EXPORT using crc12_cdma2000          = crc<12,    0xF13,    0xFFF, false, false,    0x000>; // academic
-ZCRC_EXPORT using crc12_dect              = crc<12,    0x80F,    0x000, false, false,    0x000>; // academic
-ZCRC_EXPORT using crc12_gsm               = crc<12,    0xD31,    0x000, false, false,    0xFFF>; // academic
-ZCRC_EXPORT using crc12_umts              = crc<12,    0x80F,    0x000, false,  true,    0x000>; // academic
-ZCRC_EXPORT using crc13_bbc               = crc<13,   0x1CF5,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc14_darc              = crc<14,   0x0805,   0x0000,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc14_gsm               = crc<14,   0x202D,   0x0000, false, false,   0x3FFF>; // academic
-ZCRC_EXPORT using crc15_can               = crc<15,   0x4599,   0x0000, false, false,   0x0000>; // academic
-ZCRC_EXPORT using crc15_mpt1327           = crc<15,   0x6815,   0x0000, false, false,   0x0001>; // attested
-ZCRC_EXPORT using crc16_arc               = crc<16,   0x8005,   0x0000,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_cdma2000          = crc<16,   0xC867,   0xFFFF, false, false,   0x0000>; // academic
-ZCRC_EXPORT using crc16_cms               = crc<16,   0x8005,   0xFFFF, false, false,   0x0000>; // third_party
-ZCRC_EXPORT using crc16_dds_110           = crc<16,   0x8005,   0x800D, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_dect_r            = crc<16,   0x0589,   0x0000, false, false,   0x0001>; // attested
-ZCRC_EXPORT using crc16_dect_x            = crc<16,   0x0589,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_dnp               = crc<16,   0x3D65,   0x0000,  true,  true,   0xFFFF>; // confirmed
-ZCRC_EXPORT using crc16_en_13757          = crc<16,   0x3D65,   0x0000, false, false,   0xFFFF>; // confirmed
-ZCRC_EXPORT using crc16_genibus           = crc<16,   0x1021,   0xFFFF, false, false,   0xFFFF>; // attested
-ZCRC_EXPORT using crc16_gsm               = crc<16,   0x1021,   0x0000, false, false,   0xFFFF>; // attested
-ZCRC_EXPORT using crc16_ibm_3740          = crc<16,   0x1021,   0xFFFF, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_ibm_sdlc          = crc<16,   0x1021,   0xFFFF,  true,  true,   0xFFFF>; // attested
-ZCRC_EXPORT using crc16_iso_iec_14443_3_a = crc<16,   0x1021,   0xC6C6,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_kermit            = crc<16,   0x1021,   0x0000,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_lj1200            = crc<16,   0x6F63,   0x0000, false, false,   0x0000>; // third_party
-ZCRC_EXPORT using crc16_m17               = crc<16,   0x5935,   0xFFFF, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_maxim_dow         = crc<16,   0x8005,   0x0000,  true,  true,   0xFFFF>; // attested
-ZCRC_EXPORT using crc16_mcrf4xx           = crc<16,   0x1021,   0xFFFF,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_modbus            = crc<16,   0x8005,   0xFFFF,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_nrsc_5            = crc<16,   0x080B,   0xFFFF,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_opensafety_a      = crc<16,   0x5935,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_opensafety_b      = crc<16,   0x755B,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_profibus          = crc<16,   0x1DCF,   0xFFFF, false, false,   0xFFFF>; // attested
-ZCRC_EXPORT using crc16_riello            = crc<16,   0x1021,   0xB2AA,  true,  true,   0x0000>; // third_party
-ZCRC_EXPORT using crc16_spi_fujitsu       = crc<16,   0x1021,   0x1D0F, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_t10_dif           = crc<16,   0x8BB7,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_teledisk          = crc<16,   0xA097,   0x0000, false, false,   0x0000>; // confirmed
-ZCRC_EXPORT using crc16_tms37157          = crc<16,   0x1021,   0x89EC,  true,  true,   0x0000>; // attested
-ZCRC_EXPORT using crc16_umts              = crc<16,   0x8005,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc16_usb               = crc<16,   0x8005,   0xFFFF,  true,  true,   0xFFFF>; // confirmed
-ZCRC_EXPORT using crc16_xmodem            = crc<16,   0x1021,   0x0000, false, false,   0x0000>; // attested
-ZCRC_EXPORT using crc17_can_fd            = crc<17,  0x1685B,  0x00000, false, false,  0x00000>; // academic
-ZCRC_EXPORT using crc21_can_fd            = crc<21, 0x102899, 0x000000, false, false, 0x000000>; // academic
-ZCRC_EXPORT using crc24_ble               = crc<24, 0x00065B, 0x555555,  true,  true, 0x000000>; // attested
-ZCRC_EXPORT using crc24_flexray_a         = crc<24, 0x5D6DCB, 0xFEDCBA, false, false, 0x000000>; // attested
-ZCRC_EXPORT using crc24_flexray_b         = crc<24, 0x5D6DCB, 0xABCDEF, false, false, 0x000000>; // attested
-ZCRC_EXPORT using crc24_interlaken        = crc<24, 0x328B63, 0xFFFFFF, false, false, 0xFFFFFF>; // academic
-ZCRC_EXPORT using crc24_lte_a             = crc<24, 0x864CFB, 0x000000, false, false, 0x000000>; // academic
-ZCRC_EXPORT using crc24_lte_b             = crc<24, 0x800063, 0x000000, false, false, 0x000000>; // academic
-ZCRC_EXPORT using crc24_openpgp           = crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>; // attested
-ZCRC_EXPORT using crc24_os_9              = crc<24, 0x800063, 0xFFFFFF, false, false, 0xFFFFFF>; // attested
-ZCRC_EXPORT using crc30_cdma              = crc<30, 0x2030B9C7, 0x3FFFFFFF, false, false, 0x3FFFFFFF>; // academic
-ZCRC_EXPORT using crc31_philips           = crc<31, 0x04C11DB7, 0x7FFFFFFF, false, false, 0x7FFFFFFF>; // confirmed
-ZCRC_EXPORT using crc32_aixm              = crc<32, 0x814141AB, 0x00000000, false, false, 0x00000000>; // attested
-ZCRC_EXPORT using crc32_autosar           = crc<32, 0xF4ACFB13, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
-ZCRC_EXPORT using crc32_base91_d          = crc<32, 0xA833982B, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // confirmed
-ZCRC_EXPORT using crc32                   = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF>; // attested
-ZCRC_EXPORT using crc32_cd_rom_edc        = crc<32, 0x8001801B, 0x00000000,  true,  true, 0x00000000>; // academic
-ZCRC_EXPORT using crc32_cksum             = crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF>; // attested
-ZCRC_EXPORT using crc32c                  = crc<32, 0x1EDC6F41, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
-ZCRC_EXPORT using crc32_iso_hdlc          = crc<32, 0x04C11DB7, 0xFFFFFFFF,  true,  true, 0xFFFFFFFF>; // attested
-ZCRC_EXPORT using crc32_jamcrc            = crc<32, 0x04C11DB7, 0xFFFFFFFF,  true,  true, 0x00000000>; // confirmed
-ZCRC_EXPORT using crc32_mef               = crc<32, 0x741B8CD7, 0xFFFFFFFF,  true,  true, 0x00000000>; // attested
-ZCRC_EXPORT using crc32_mpeg2             = crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000>; // attested
-ZCRC_EXPORT using crc32_xfer              = crc<32, 0x000000AF, 0x00000000, false, false, 0x00000000>; // confirmed
-ZCRC_EXPORT using crc40_gsm               = crc<40, 0x0004820009, 0x0000000000, false, false, 0xFFFFFFFFFF>; // academic
-ZCRC_EXPORT using crc64_ecma_182          = crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000>; // academic
-ZCRC_EXPORT using crc64_go_iso            = crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // confirmed
-ZCRC_EXPORT using crc64_ms                = crc<64, 0x259C84CBA6426349, 0xFFFFFFFFFFFFFFFF,  true,  true, 0x0000000000000000>; // attested
-ZCRC_EXPORT using crc64_nvme              = crc<64, 0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // attested
-ZCRC_EXPORT using crc64_redis             = crc<64, 0xAD93D23594C935A9, 0x0000000000000000,  true,  true, 0x0000000000000000>; // academic
-ZCRC_EXPORT using crc64_we                = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, false, false, 0xFFFFFFFFFFFFFFFF>; // confirmed
-ZCRC_EXPORT using crc64_xz                = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF>; // attested
-// ZCRC_EXPORT using crc82_darc = crc<82, std::bitset<82>{"0000000000110000100011000000000100010001000000010001010000000001010001000000010000010001"}, 0x0,  true,  true, >; // attested
-// clang-format on
+namespace detail {
+
+struct kafka_verify_fn {
+    // Returns every record batch in [buffer] (a fetch response's records, say), in
+    // order, each flagged by whether its CRC matches. Parsing stops at a batch that
+    // the buffer cuts off, which a fetch response is allowed to end with, or whose
+    // header makes no sense; the caller can tell which from where the last batch ends.
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<kafka::batch>
+    operator()(const algorithm auto algo, R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        const auto size {static_cast<std::size_t>(std::ranges::size(buffer))};
+        const auto at {[&] (const std::size_t offset) {
+            return std::ranges::begin(buffer) + static_cast<std::ranges::range_difference_t<R>>(offset);
+        }};
+
+        // A record batch (magic 2) is:
+        //
+        //   i64be base offset
+        //   i32be length of the rest of the batch
+        //   i32be partition leader epoch
+        //   i8    magic (2)
+        //   u32be CRC-32C of everything from attributes on
+        //   i16be attributes
+        //   ...   (at least 40 more bytes of header, then the records)
+        //
+        // Older message sets (magic 0 and 1) share the layout up to the magic, but
+        // their CRC-32 (zlib's) comes right before it, and covers everything from it on:
+        //
+        //   i64be offset
+        //   i32be length of the rest of the message
+        //   u32be CRC-32 of everything from magic on
+        //   i8    magic (0 or 1)
+        //   ...   (at least 9 more bytes)
+        //
+        // Like TFRecord's, the headers are parsed as we walk the buffer, and the CRCs
+        // checked afterwards in a batch. Batches of the current format go straight to
+        // process_batch; the rare legacy ones are left empty there and batched by index.
+        std::vector<kafka::batch> batches;
+        std::vector<std::size_t> legacy;
+        for (std::size_t offset {0}; size - offset >= 17;) {
+            const auto length {detail::load_be<std::uint32_t>(at(offset + 8))};
+            const auto magic {static_cast<std::uint8_t>(*at(offset + 16))};
+            if (magic > 2 || length < (magic == 2 ? 49U : 14U) || length > size - offset - 12) {
+                break;
+            }
+            if (magic != 2) {
+                legacy.push_back(batches.size());
+            }
+            batches.push_back({offset, 12 + static_cast<std::size_t>(length), true});
+            offset += 12 + static_cast<std::size_t>(length);
+        }
+
+        const auto covered {[&] (const kafka::batch& b, const std::size_t from) {
+            return std::ranges::subrange {at(b.offset + from), at(b.offset + b.size)};
+        }};
+        const auto stored {[&] (const kafka::batch& b, const std::size_t crc_offset) {
+            return detail::load_be<std::uint32_t>(at(b.offset + crc_offset));
+        }};
+        (void)detail::process_batch(algo, crc32c {}, batches.size(),
+            [&] (const std::size_t i) {
+                const bool current {static_cast<std::uint8_t>(*at(batches[i].offset + 16)) == 2};
+                return covered(batches[i], current ? 21 : batches[i].size);
+            },
+            [&] (const std::size_t i, const crc32c c) {
+                if (static_cast<std::uint8_t>(*at(batches[i].offset + 16)) == 2) {
+                    batches[i].intact = finalize(c) == stored(batches[i], 17);
+                }
+                return true;
+            });
+        (void)detail::process_batch(algo, crc32_iso_hdlc {}, legacy.size(),
+            [&] (const std::size_t i) { return covered(batches[legacy[i]], 16); },
+            [&] (const std::size_t i, const crc32_iso_hdlc c) {
+                batches[legacy[i]].intact = finalize(c) == stored(batches[legacy[i]], 12);
+                return true;
+            });
+        return batches;
+    }
+
+    template <detail::byte_buffer R>
+    [[nodiscard]] ZCRC_STATIC_CALL_OPERATOR constexpr std::vector<kafka::batch>
+    operator()(R&& buffer) ZCRC_CONST_CALL_OPERATOR {
+        return kafka_verify_fn::operator()(default_algorithm, buffer);
+    }
+};
+
+} // namespace detail
+
+namespace png {
+
+ZCRC_EXPORT inline constexpr detail::png_verify_fn verify {};
+
+} // namespace png
+
+namespace zip {
+
+ZCRC_EXPORT inline constexpr detail::zip_verify_fn verify {};
+
+} // namespace zip
+
+namespace gzip {
+
+ZCRC_EXPORT inline constexpr detail::gzip_verify_fn verify {};
+
+} // namespace gzip
+
+namespace parquet {
+
+ZCRC_EXPORT inline constexpr detail::parquet_verify_fn verify {};
+
+} // namespace parquet
+
+namespace kafka {
+
+ZCRC_EXPORT inline constexpr detail::kafka_verify_fn verify {};
+
+} // namespace kafka
 
 } // namespace zcrc
 
@@ -773,6 +4215,20 @@ ZCRC_EXPORT using crc64_xz                = crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFF
 #undef ZCRC_STATIC_CALL_OPERATOR
 #undef ZCRC_CONST_CALL_OPERATOR
 #undef ZCRC_STATIC23
+#undef ZCRC_X86_64_KERNELS
+#undef ZCRC_CLMUL_TARGET
+#undef ZCRC_CRC32_TARGET
+#undef ZCRC_NIBBLE_TARGET
+#undef ZCRC_AVX2_KERNELS
+#undef ZCRC_AARCH64_CRC32_KERNELS
+#undef ZCRC_AARCH64_PMULL_KERNELS
+#undef ZCRC_RISCV_ZBC_KERNELS
+#undef ZCRC_POWER8_KERNELS
+#undef ZCRC_CRC32_KERNELS
+#undef ZCRC_CLMUL_KERNELS
+#undef ZCRC_WASM_SIMD128_KERNELS
+#undef ZCRC_NIBBLE_KERNELS
+#undef ZCRC_NUMA
 
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(pop)
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+
+// An inflater (see zcrc::inflater) backed by zlib, for zcrc::gzip::verify and
+// zcrc::zip::verify. Using this header requires linking zlib.
+//
+// We drive zlib with inflateBack, which calls us with each piece of output
+// straight out of its 32 KiB window, so the CRC is folded in while the data
+// is still in cache rather than in a second pass over the output.
+
+#ifndef ZCRC_ZLIB_HPP_INCLUDED
+#define ZCRC_ZLIB_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include <zlib.h>
+
+#include <zcrc/zcrc.hpp>
+
+namespace zcrc::inline v1 {
+
+namespace detail {
+
+struct zlib_inflate_fn {
+    template <typename F>
+    [[nodiscard]] std::optional<std::size_t> operator()(const std::span<const unsigned char> in, F&& out) const {
+        struct source {
+            std::span<const unsigned char> remaining;
+            std::size_t fed;
+        } source_ {in, 0};
+
+        // zlib counts in unsigned ints, so hand it the input a piece at a time.
+        const auto pull {[] (void * const desc, z_const unsigned char ** const buf) -> unsigned {
+            auto& src {*static_cast<source *>(desc)};
+            const auto n {(std::min<std::size_t>)(src.remaining.size(), UINT_MAX)};
+            *buf = const_cast<unsigned char *>(src.remaining.data());
+            src.remaining = src.remaining.subspan(n);
+            src.fed += n;
+            return static_cast<unsigned>(n);
+        }};
+        const auto push {[] (void * const desc, unsigned char * const buf, const unsigned len) -> int {
+            (*static_cast<std::remove_reference_t<F> *>(desc))(std::span<const unsigned char> {buf, len});
+            return 0;
+        }};
+
+        z_stream stream {};
+        std::array<unsigned char, std::size_t {1} << 15> window; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        if (inflateBackInit(&stream, 15, window.data()) != Z_OK) {
+            return std::nullopt;
+        }
+        const int r {inflateBack(&stream, +pull, &source_, +push, &out)};
+        // On success, zlib leaves whatever it didn't consume of the last piece in avail_in.
+        const std::size_t consumed {source_.fed - (stream.next_in == nullptr ? 0 : stream.avail_in)};
+        inflateBackEnd(&stream);
+        if (r != Z_STREAM_END) {
+            return std::nullopt;
+        }
+        return consumed;
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::zlib_inflate_fn zlib_inflate {};
+
+} // namespace zcrc
+
+#endif // ZCRC_ZLIB_HPP_INCLUDED
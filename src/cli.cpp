@@ -0,0 +1,676 @@
+// SPDX-License-Identifier: MIT
+
+// zcrc, a command-line front end to the library. Build it with -DZCRC_CLI=ON.
+//
+//    zcrc [-a ALGORITHM] [--json] [PATH]...
+//        Print the CRC of each file. Directories are walked recursively; no
+//        paths, or -, means standard input.
+//    zcrc [-a ALGORITHM] [--json] --check MANIFEST...
+//        Verify files against manifests in the format printed above.
+//    zcrc --list
+//        List the algorithms: every CRC the library predefines, plus cksum.
+//
+// The default algorithm is crc32_iso_hdlc (zlib's, and that of the crc32 tool).
+// With -a cksum, both the checksum and the output format match POSIX cksum.
+//
+// Files of at least large_file bytes are mapped and spread across threads with
+// zcrc::parallel, one at a time; smaller ones are handed out whole to a pool of
+// workers, so a directory of many small files keeps every core busy too. Files
+// with holes are only read where they have data (see find_data); each hole is
+// accounted for with zcrc::process_zero_bytes.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ZCRC_CLI_MMAP
+#endif
+
+#include <zcrc/zcrc.hpp>
+
+namespace {
+
+constexpr std::uintmax_t large_file {std::uintmax_t {16} << 20};
+
+struct result {
+    std::uint64_t crc;
+    std::uint64_t size;
+};
+
+template <typename CRC>
+[[nodiscard]] result compute_buffer(const std::span<const unsigned char> data, const bool parallel) {
+    return {
+        parallel ? CRC::compute(zcrc::parallel<zcrc::default_algorithm>, data) : CRC::compute(data),
+        data.size(),
+    };
+}
+
+// A run of bytes of a sparse file that may hold data; anything between two extents
+// is a hole, and reads as zeros.
+struct extent {
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+// Computes the CRC of [file], reading only its data [extents]. The data is cut into
+// pieces of at most large_file bytes, which are spread across threads if [parallel],
+// then composed with the holes between them.
+template <typename CRC>
+[[nodiscard]] result compute_sparse(const std::span<const unsigned char> file, const std::span<const extent> extents, const bool parallel) {
+    struct piece {
+        std::size_t part;
+        std::uint64_t offset;
+    };
+    std::vector<std::pair<CRC, std::uint64_t>> parts;
+    std::vector<piece> pieces;
+    std::uint64_t at {0};
+    const auto skip_to {[&] (const std::uint64_t end) {
+        if (end > at) {
+            parts.emplace_back(zcrc::process_zero_bytes(CRC {}, end - at), end - at);
+            at = end;
+        }
+    }};
+    for (const auto [offset, size] : extents) {
+        skip_to(offset);
+        for (; at < offset + size; at += parts.back().second) {
+            pieces.push_back({parts.size(), at});
+            parts.emplace_back(CRC {}, (std::min<std::uint64_t>)(offset + size - at, large_file));
+        }
+    }
+    skip_to(file.size());
+
+    std::atomic<std::size_t> next {0};
+    const auto worker {[&] {
+        for (std::size_t i {next++}; i < pieces.size(); i = next++) {
+            auto& [state, size] {parts[pieces[i].part]};
+            state = zcrc::process(state, file.subspan(static_cast<std::size_t>(pieces[i].offset), static_cast<std::size_t>(size)));
+        }
+    }};
+    {
+        const std::size_t threads {parallel ? (std::min<std::size_t>)((std::max)(std::jthread::hardware_concurrency(), 1U), pieces.size()) : 1};
+        std::vector<std::jthread> pool;
+        for (std::size_t t {1}; t < threads; ++t) {
+            pool.emplace_back(worker);
+        }
+        worker();
+    } // Joins the pool.
+    return {zcrc::finalize(zcrc::compose(parts)), file.size()};
+}
+
+template <typename CRC>
+[[nodiscard]] result compute_stream(std::istream& in) {
+    CRC state {};
+    std::uint64_t size {0};
+    std::array<char, std::size_t {1} << 16> buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    while (in.read(buffer.data(), buffer.size()) || in.gcount() != 0) {
+        state = zcrc::process(state, buffer.data(), buffer.data() + in.gcount());
+        size += static_cast<std::uint64_t>(in.gcount());
+    }
+    return {zcrc::finalize(state), size};
+}
+
+[[nodiscard]] result cksum_buffer(const std::span<const unsigned char> data, const bool parallel) {
+    return {
+        parallel ? zcrc::posix_cksum(zcrc::parallel<zcrc::default_algorithm>, data) : zcrc::posix_cksum(data),
+        data.size(),
+    };
+}
+
+[[nodiscard]] result cksum_stream(std::istream& in) {
+    const auto [crc, size] {compute_stream<zcrc::crc32_cksum>(in)};
+    return {zcrc::posix_cksum(zcrc::crc32_cksum {zcrc::from_finalized, static_cast<std::uint32_t>(crc)}, size), size};
+}
+
+[[nodiscard]] result cksum_sparse(const std::span<const unsigned char> file, const std::span<const extent> extents, const bool parallel) {
+    const auto [crc, size] {compute_sparse<zcrc::crc32_cksum>(file, extents, parallel)};
+    return {zcrc::posix_cksum(zcrc::crc32_cksum {zcrc::from_finalized, static_cast<std::uint32_t>(crc)}, size), size};
+}
+
+struct algorithm_info {
+    std::string_view name;
+    std::size_t width;
+    bool cksum;
+    result (*buffer)(std::span<const unsigned char>, bool);
+    result (*stream)(std::istream&);
+    result (*sparse)(std::span<const unsigned char>, std::span<const extent>, bool);
+};
+
+template <typename CRC>
+[[nodiscard]] constexpr algorithm_info entry(const std::string_view name) {
+    return {name, CRC::width, false, &compute_buffer<CRC>, &compute_stream<CRC>, &compute_sparse<CRC>};
+}
+
+// clang-format off
+constexpr std::array algorithms {
+    algorithm_info {"cksum", 32, true, &cksum_buffer, &cksum_stream, &cksum_sparse},
+    entry<zcrc::crc3_gsm>("crc3_gsm"),
+    entry<zcrc::crc3_rohc>("crc3_rohc"),
+    entry<zcrc::crc4_g_704>("crc4_g_704"),
+    entry<zcrc::crc4_interlaken>("crc4_interlaken"),
+    entry<zcrc::crc5_epc_c1g2>("crc5_epc_c1g2"),
+    entry<zcrc::crc5_g_704>("crc5_g_704"),
+    entry<zcrc::crc5_usb>("crc5_usb"),
+    entry<zcrc::crc6_cdma2000_a>("crc6_cdma2000_a"),
+    entry<zcrc::crc6_cdma2000_b>("crc6_cdma2000_b"),
+    entry<zcrc::crc6_darc>("crc6_darc"),
+    entry<zcrc::crc6_g_704>("crc6_g_704"),
+    entry<zcrc::crc6_gsm>("crc6_gsm"),
+    entry<zcrc::crc7_mmc>("crc7_mmc"),
+    entry<zcrc::crc7_rohc>("crc7_rohc"),
+    entry<zcrc::crc7_umts>("crc7_umts"),
+    entry<zcrc::crc8_autosar>("crc8_autosar"),
+    entry<zcrc::crc8_bluetooth>("crc8_bluetooth"),
+    entry<zcrc::crc8_cdma2000>("crc8_cdma2000"),
+    entry<zcrc::crc8_darc>("crc8_darc"),
+    entry<zcrc::crc8_dvb_s2>("crc8_dvb_s2"),
+    entry<zcrc::crc8_gsm_a>("crc8_gsm_a"),
+    entry<zcrc::crc8_gsm_b>("crc8_gsm_b"),
+    entry<zcrc::crc8_hitag>("crc8_hitag"),
+    entry<zcrc::crc8_i_432_1>("crc8_i_432_1"),
+    entry<zcrc::crc8_i_code>("crc8_i_code"),
+    entry<zcrc::crc8_lte>("crc8_lte"),
+    entry<zcrc::crc8_maxim_dow>("crc8_maxim_dow"),
+    entry<zcrc::crc8_mifare_mad>("crc8_mifare_mad"),
+    entry<zcrc::crc8_nrsc_5>("crc8_nrsc_5"),
+    entry<zcrc::crc8_opensafety>("crc8_opensafety"),
+    entry<zcrc::crc8_rohc>("crc8_rohc"),
+    entry<zcrc::crc8_sae_j1850>("crc8_sae_j1850"),
+    entry<zcrc::crc8_smbus>("crc8_smbus"),
+    entry<zcrc::crc8_tech_3250>("crc8_tech_3250"),
+    entry<zcrc::crc8_wcdma>("crc8_wcdma"),
+    entry<zcrc::crc10_atm>("crc10_atm"),
+    entry<zcrc::crc10_cdma2000>("crc10_cdma2000"),
+    entry<zcrc::crc10_gsm>("crc10_gsm"),
+    entry<zcrc::crc11_flexray>("crc11_flexray"),
+    entry<zcrc::crc11_umts>("crc11_umts"),
+    entry<zcrc::crc12_cdma2000>("crc12_cdma2000"),
+    entry<zcrc::crc12_dect>("crc12_dect"),
+    entry<zcrc::crc12_gsm>("crc12_gsm"),
+    entry<zcrc::crc12_umts>("crc12_umts"),
+    entry<zcrc::crc13_bbc>("crc13_bbc"),
+    entry<zcrc::crc14_darc>("crc14_darc"),
+    entry<zcrc::crc14_gsm>("crc14_gsm"),
+    entry<zcrc::crc15_can>("crc15_can"),
+    entry<zcrc::crc15_mpt1327>("crc15_mpt1327"),
+    entry<zcrc::crc16_arc>("crc16_arc"),
+    entry<zcrc::crc16_cdma2000>("crc16_cdma2000"),
+    entry<zcrc::crc16_cms>("crc16_cms"),
+    entry<zcrc::crc16_dds_110>("crc16_dds_110"),
+    entry<zcrc::crc16_dect_r>("crc16_dect_r"),
+    entry<zcrc::crc16_dect_x>("crc16_dect_x"),
+    entry<zcrc::crc16_dnp>("crc16_dnp"),
+    entry<zcrc::crc16_en_13757>("crc16_en_13757"),
+    entry<zcrc::crc16_genibus>("crc16_genibus"),
+    entry<zcrc::crc16_gsm>("crc16_gsm"),
+    entry<zcrc::crc16_ibm_3740>("crc16_ibm_3740"),
+    entry<zcrc::crc16_ibm_sdlc>("crc16_ibm_sdlc"),
+    entry<zcrc::crc16_iso_iec_14443_3_a>("crc16_iso_iec_14443_3_a"),
+    entry<zcrc::crc16_kermit>("crc16_kermit"),
+    entry<zcrc::crc16_lj1200>("crc16_lj1200"),
+    entry<zcrc::crc16_m17>("crc16_m17"),
+    entry<zcrc::crc16_maxim_dow>("crc16_maxim_dow"),
+    entry<zcrc::crc16_mcrf4xx>("crc16_mcrf4xx"),
+    entry<zcrc::crc16_modbus>("crc16_modbus"),
+    entry<zcrc::crc16_nrsc_5>("crc16_nrsc_5"),
+    entry<zcrc::crc16_opensafety_a>("crc16_opensafety_a"),
+    entry<zcrc::crc16_opensafety_b>("crc16_opensafety_b"),
+    entry<zcrc::crc16_profibus>("crc16_profibus"),
+    entry<zcrc::crc16_riello>("crc16_riello"),
+    entry<zcrc::crc16_spi_fujitsu>("crc16_spi_fujitsu"),
+    entry<zcrc::crc16_t10_dif>("crc16_t10_dif"),
+    entry<zcrc::crc16_teledisk>("crc16_teledisk"),
+    entry<zcrc::crc16_tms37157>("crc16_tms37157"),
+    entry<zcrc::crc16_umts>("crc16_umts"),
+    entry<zcrc::crc16_usb>("crc16_usb"),
+    entry<zcrc::crc16_xmodem>("crc16_xmodem"),
+    entry<zcrc::crc17_can_fd>("crc17_can_fd"),
+    entry<zcrc::crc21_can_fd>("crc21_can_fd"),
+    entry<zcrc::crc24_ble>("crc24_ble"),
+    entry<zcrc::crc24_flexray_a>("crc24_flexray_a"),
+    entry<zcrc::crc24_flexray_b>("crc24_flexray_b"),
+    entry<zcrc::crc24_interlaken>("crc24_interlaken"),
+    entry<zcrc::crc24_lte_a>("crc24_lte_a"),
+    entry<zcrc::crc24_lte_b>("crc24_lte_b"),
+    entry<zcrc::crc24_openpgp>("crc24_openpgp"),
+    entry<zcrc::crc24_os_9>("crc24_os_9"),
+    entry<zcrc::crc30_cdma>("crc30_cdma"),
+    entry<zcrc::crc31_philips>("crc31_philips"),
+    entry<zcrc::crc32_aixm>("crc32_aixm"),
+    entry<zcrc::crc32_autosar>("crc32_autosar"),
+    entry<zcrc::crc32_base91_d>("crc32_base91_d"),
+    entry<zcrc::crc32>("crc32"),
+    entry<zcrc::crc32_cd_rom_edc>("crc32_cd_rom_edc"),
+    entry<zcrc::crc32_cksum>("crc32_cksum"),
+    entry<zcrc::crc32c>("crc32c"),
+    entry<zcrc::crc32_iso_hdlc>("crc32_iso_hdlc"),
+    entry<zcrc::crc32_jamcrc>("crc32_jamcrc"),
+    entry<zcrc::crc32_mef>("crc32_mef"),
+    entry<zcrc::crc32_mpeg2>("crc32_mpeg2"),
+    entry<zcrc::crc32_xfer>("crc32_xfer"),
+    entry<zcrc::crc40_gsm>("crc40_gsm"),
+    entry<zcrc::crc64_ecma_182>("crc64_ecma_182"),
+    entry<zcrc::crc64_go_iso>("crc64_go_iso"),
+    entry<zcrc::crc64_ms>("crc64_ms"),
+    entry<zcrc::crc64_nvme>("crc64_nvme"),
+    entry<zcrc::crc64_redis>("crc64_redis"),
+    entry<zcrc::crc64_we>("crc64_we"),
+    entry<zcrc::crc64_xz>("crc64_xz"),
+};
+// clang-format on
+
+[[nodiscard]] const algorithm_info * find_algorithm(const std::string_view name) {
+    const auto it {std::ranges::find(algorithms, name, &algorithm_info::name)};
+    return it == algorithms.end() ? nullptr : &*it;
+}
+
+#if defined(ZCRC_CLI_MMAP) && defined(SEEK_DATA) && defined(SEEK_HOLE)
+// Finds where the file behind [fd] has data, if it has any holes at all. Returns
+// std::nullopt if it has none (judging by its allocated size, which is cheap to
+// check), or if the file system can't tell us where they are.
+[[nodiscard]] std::optional<std::vector<extent>> find_data(const int fd, const struct stat& st) {
+    if (static_cast<std::uint64_t>(st.st_blocks) * 512 >= static_cast<std::uint64_t>(st.st_size)) {
+        return std::nullopt;
+    }
+    std::vector<extent> extents;
+    for (off_t at {0}; at < st.st_size;) {
+        const off_t data {::lseek(fd, at, SEEK_DATA)};
+        if (data < 0) {
+            if (errno == ENXIO) {
+                break; // The rest of the file is a hole.
+            }
+            return std::nullopt;
+        }
+        const off_t hole {::lseek(fd, data, SEEK_HOLE)};
+        if (hole < 0) {
+            return std::nullopt;
+        }
+        const off_t end {(std::min)(hole, st.st_size)};
+        extents.push_back({static_cast<std::uint64_t>(data), static_cast<std::uint64_t>(end - data)});
+        at = end;
+    }
+    return extents;
+}
+#else
+[[nodiscard]] std::optional<std::vector<extent>> find_data(int, const struct stat&) {
+    return std::nullopt;
+}
+#endif
+
+// Reads (or maps) the file at [path] and computes its CRC, spreading the work
+// across threads if [parallel]. Throws std::system_error on failure.
+[[nodiscard]] result compute_file(const algorithm_info& algorithm, const std::filesystem::path& path, const bool parallel) {
+#ifdef ZCRC_CLI_MMAP
+    const int fd {::open(path.c_str(), O_RDONLY)}; // NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (fd < 0) {
+        throw std::system_error {errno, std::generic_category()};
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        const int error {errno};
+        ::close(fd);
+        throw std::system_error {error, std::generic_category()};
+    }
+    const auto size {static_cast<std::size_t>(st.st_size)};
+    if (!S_ISREG(st.st_mode) || size == 0) {
+        // Maybe a pipe or a device; either way, there's nothing to map.
+        ::close(fd);
+        std::ifstream in {path, std::ios::binary};
+        return algorithm.stream(in);
+    }
+    const std::optional<std::vector<extent>> extents {find_data(fd, st)};
+    void * const data {::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    const int error {errno};
+    ::close(fd);
+    if (data == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        throw std::system_error {error, std::generic_category()};
+    }
+    const std::span<const unsigned char> file {static_cast<const unsigned char *>(data), size};
+    ::madvise(data, size, MADV_SEQUENTIAL);
+    const result r {extents ? algorithm.sparse(file, *extents, parallel) : algorithm.buffer(file, parallel)};
+    ::munmap(data, size);
+    return r;
+#else
+    std::ifstream in {path, std::ios::binary};
+    if (!in) {
+        throw std::system_error {std::make_error_code(std::errc::no_such_file_or_directory)};
+    }
+    if (!parallel) {
+        return algorithm.stream(in);
+    }
+    std::vector<unsigned char> data(static_cast<std::size_t>(std::filesystem::file_size(path)));
+    in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    data.resize(static_cast<std::size_t>(in.gcount()));
+    return algorithm.buffer(data, parallel);
+#endif
+}
+
+struct job {
+    std::string name;                 // As printed; "-" for standard input.
+    std::optional<result> expected;   // Only in --check mode.
+    std::optional<result> actual;
+    std::string error;
+};
+
+// Computes every job's CRC: standard input first, then large files one at a time
+// (each spread across all threads), then small files, one per worker at a time.
+void run(const algorithm_info& algorithm, std::vector<job>& jobs) {
+    std::vector<std::size_t> small;
+    for (std::size_t i {0}; i < jobs.size(); ++i) {
+        job& j {jobs[i]};
+        if (j.name == "-") {
+            j.actual = algorithm.stream(std::cin);
+            continue;
+        }
+        std::error_code ec;
+        const std::uintmax_t size {std::filesystem::file_size(j.name, ec)};
+        if (ec || size < large_file) {
+            small.push_back(i);
+            continue;
+        }
+        try {
+            j.actual = compute_file(algorithm, j.name, true);
+        } catch (const std::exception& e) {
+            j.error = e.what();
+        }
+    }
+
+    std::atomic<std::size_t> next {0};
+    const auto worker {[&] {
+        for (std::size_t i {next++}; i < small.size(); i = next++) {
+            job& j {jobs[small[i]]};
+            try {
+                j.actual = compute_file(algorithm, j.name, false);
+            } catch (const std::exception& e) {
+                j.error = e.what();
+            }
+        }
+    }};
+    const std::size_t threads {(std::min<std::size_t>)((std::max)(std::jthread::hardware_concurrency(), 1U), small.size())};
+    std::vector<std::jthread> pool;
+    for (std::size_t t {1}; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+}
+
+// Appends [paths] to [jobs], walking directories recursively in a stable order.
+// Returns false if any path couldn't be read.
+[[nodiscard]] bool expand(const std::vector<std::string>& paths, std::vector<job>& jobs) {
+    bool ok {true};
+    for (const std::string& path : paths) {
+        std::error_code ec;
+        if (path == "-" || !std::filesystem::is_directory(path, ec)) {
+            jobs.push_back({path, {}, {}, {}});
+            continue;
+        }
+        std::vector<std::string> files;
+        for (auto it {std::filesystem::recursive_directory_iterator {path, ec}};
+             !ec && it != std::filesystem::recursive_directory_iterator {}; it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                files.push_back(it->path().string());
+            }
+        }
+        if (ec) {
+            std::cerr << "zcrc: " << path << ": " << ec.message() << '\n';
+            ok = false;
+        }
+        std::ranges::sort(files);
+        for (std::string& file : files) {
+            jobs.push_back({std::move(file), {}, {}, {}});
+        }
+    }
+    return ok;
+}
+
+[[nodiscard]] std::string format_crc(const algorithm_info& algorithm, const result r) {
+    if (algorithm.cksum) {
+        return std::to_string(r.crc);
+    }
+    std::string hex((algorithm.width + 3) / 4, '0');
+    std::uint64_t crc {r.crc};
+    for (auto it {hex.rbegin()}; it != hex.rend(); ++it, crc >>= 4) {
+        *it = "0123456789abcdef"[crc & 0xF];
+    }
+    return hex;
+}
+
+// Parses a manifest line as printed in [algorithm]'s format, returning the
+// expected result and the file name.
+[[nodiscard]] std::optional<std::pair<result, std::string>> parse_line(const algorithm_info& algorithm, std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    result expected {};
+    if (algorithm.cksum) {
+        // "CRC SIZE NAME", or "CRC SIZE" for standard input.
+        const char * const end {line.data() + line.size()};
+        const auto crc {std::from_chars(line.data(), end, expected.crc)};
+        if (crc.ec != std::errc {} || crc.ptr == end || *crc.ptr != ' ') {
+            return std::nullopt;
+        }
+        const auto size {std::from_chars(crc.ptr + 1, end, expected.size)};
+        if (size.ec != std::errc {}) {
+            return std::nullopt;
+        }
+        if (size.ptr == end) {
+            return std::pair {expected, std::string {"-"}};
+        }
+        if (*size.ptr != ' ') {
+            return std::nullopt;
+        }
+        return std::pair {expected, std::string {size.ptr + 1, end}};
+    }
+    // "CRC  NAME", or "CRC *NAME" as written by the *sum tools in binary mode.
+    const std::size_t digits {(algorithm.width + 3) / 4};
+    if (line.size() < digits + 3 || line[digits] != ' ' || (line[digits + 1] != ' ' && line[digits + 1] != '*')) {
+        return std::nullopt;
+    }
+    const auto [p, ec] {std::from_chars(line.data(), line.data() + digits, expected.crc, 16)};
+    if (ec != std::errc {} || p != line.data() + digits) {
+        return std::nullopt;
+    }
+    return std::pair {expected, std::string {line.substr(digits + 2)}};
+}
+
+[[nodiscard]] std::string json_string(const std::string_view s) {
+    std::string r {"\""};
+    for (const char c : s) {
+        switch (c) {
+            case '"':  r += "\\\""; break;
+            case '\\': r += "\\\\"; break;
+            case '\n': r += "\\n"; break;
+            case '\r': r += "\\r"; break;
+            case '\t': r += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    constexpr std::string_view hex {"0123456789abcdef"};
+                    r += "\\u00";
+                    r += hex[static_cast<unsigned char>(c) >> 4];
+                    r += hex[static_cast<unsigned char>(c) & 0xF];
+                } else {
+                    r += c;
+                }
+        }
+    }
+    return r += '"';
+}
+
+// Prints each job's CRC, or its verdict in --check mode. Returns false if any
+// job failed.
+[[nodiscard]] bool report(const algorithm_info& algorithm, const std::vector<job>& jobs, const bool check, const bool json) {
+    std::size_t failed {0};
+    std::size_t unreadable {0};
+    if (json) {
+        std::cout << '[';
+    }
+    for (std::size_t i {0}; i < jobs.size(); ++i) {
+        const job& j {jobs[i]};
+        const bool ok {j.actual && (!check || (j.actual->crc == j.expected->crc && (!algorithm.cksum || j.actual->size == j.expected->size)))};
+        failed += (j.actual && !ok) ? 1 : 0;
+        unreadable += j.actual ? 0 : 1;
+        if (json) {
+            std::cout << (i == 0 ? "\n" : ",\n") << "  {\"file\": " << json_string(j.name)
+                      << ", \"algorithm\": " << json_string(algorithm.name);
+            if (j.actual) {
+                std::cout << ", \"crc\": " << json_string(format_crc(algorithm, *j.actual)) << ", \"size\": " << j.actual->size;
+            } else {
+                std::cout << ", \"error\": " << json_string(j.error);
+            }
+            if (check) {
+                std::cout << ", \"ok\": " << (ok ? "true" : "false");
+            }
+            std::cout << '}';
+        } else if (!j.actual) {
+            std::cerr << "zcrc: " << j.name << ": " << j.error << '\n';
+            if (check) {
+                std::cout << j.name << ": FAILED open or read\n";
+            }
+        } else if (check) {
+            std::cout << j.name << (ok ? ": OK\n" : ": FAILED\n");
+        } else if (algorithm.cksum) {
+            std::cout << j.actual->crc << ' ' << j.actual->size << (j.name == "-" ? "" : " " + j.name) << '\n';
+        } else {
+            std::cout << format_crc(algorithm, *j.actual) << "  " << j.name << '\n';
+        }
+    }
+    if (json) {
+        std::cout << (jobs.empty() ? "]\n" : "\n]\n");
+    }
+    if (check && !json) {
+        if (unreadable != 0) {
+            std::cerr << "zcrc: WARNING: " << unreadable << (unreadable == 1 ? " listed file" : " listed files") << " could not be read\n";
+        }
+        if (failed != 0) {
+            std::cerr << "zcrc: WARNING: " << failed << (failed == 1 ? " computed checksum" : " computed checksums") << " did NOT match\n";
+        }
+    }
+    return failed == 0 && unreadable == 0;
+}
+
+void usage(std::ostream& out) {
+    out << "usage: zcrc [-a ALGORITHM] [--json] [PATH]...\n"
+           "       zcrc [-a ALGORITHM] [--json] --check MANIFEST...\n"
+           "       zcrc --list\n"
+           "\n"
+           "Prints the CRC of each file, walking directories recursively. With no PATH,\n"
+           "or when PATH is -, reads standard input.\n"
+           "\n"
+           "  -a, --algorithm NAME  the CRC to compute (default: crc32_iso_hdlc; see --list)\n"
+           "  -c, --check           verify files against manifests in the format printed\n"
+           "      --json            print the results as JSON\n"
+           "      --list            list the supported algorithms\n"
+           "  -h, --help            print this message\n";
+}
+
+} // namespace
+
+int main(const int argc, char ** const argv) try {
+    std::ios::sync_with_stdio(false);
+
+    const algorithm_info * algorithm {find_algorithm("crc32_iso_hdlc")};
+    bool check {false};
+    bool json {false};
+    std::vector<std::string> paths;
+
+    const std::vector<std::string_view> args(argv + 1, argv + argc);
+    for (std::size_t i {0}; i < args.size(); ++i) {
+        const std::string_view arg {args[i]};
+        if (arg == "-a" || arg == "--algorithm") {
+            if (++i == args.size()) {
+                std::cerr << "zcrc: " << arg << " requires an argument\n";
+                return 2;
+            }
+            algorithm = find_algorithm(args[i]);
+            if (algorithm == nullptr) {
+                std::cerr << "zcrc: unknown algorithm '" << args[i] << "' (see --list)\n";
+                return 2;
+            }
+        } else if (arg == "-c" || arg == "--check") {
+            check = true;
+        } else if (arg == "--json") {
+            json = true;
+        } else if (arg == "--list") {
+            for (const algorithm_info& a : algorithms) {
+                std::cout << a.name << '\n';
+            }
+            return 0;
+        } else if (arg == "-h" || arg == "--help") {
+            usage(std::cout);
+            return 0;
+        } else if (arg == "--") {
+            paths.insert(paths.end(), args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+            break;
+        } else if (arg.size() > 1 && arg.front() == '-') {
+            std::cerr << "zcrc: unknown option '" << arg << "'\n";
+            usage(std::cerr);
+            return 2;
+        } else {
+            paths.emplace_back(arg);
+        }
+    }
+    if (paths.empty()) {
+        paths.emplace_back("-");
+    }
+
+    bool ok {true};
+    std::vector<job> jobs;
+    if (check) {
+        for (const std::string& manifest : paths) {
+            std::ifstream file;
+            if (manifest != "-") {
+                file.open(manifest);
+                if (!file) {
+                    std::cerr << "zcrc: " << manifest << ": cannot open\n";
+                    ok = false;
+                    continue;
+                }
+            }
+            std::istream& in {manifest == "-" ? std::cin : file};
+            std::size_t line_number {0};
+            for (std::string line; std::getline(in, line);) {
+                ++line_number;
+                if (line.empty()) {
+                    continue;
+                }
+                auto parsed {parse_line(*algorithm, line)};
+                if (!parsed) {
+                    std::cerr << "zcrc: " << manifest << ':' << line_number << ": improperly formatted line\n";
+                    ok = false;
+                    continue;
+                }
+                jobs.push_back({std::move(parsed->second), parsed->first, {}, {}});
+            }
+        }
+    } else {
+        ok = expand(paths, jobs);
+    }
+
+    run(*algorithm, jobs);
+    ok &= report(*algorithm, jobs, check, json);
+    return ok ? 0 : 1;
+} catch (const std::exception& e) {
+    std::cerr << "zcrc: " << e.what() << '\n';
+    return 1;
+}
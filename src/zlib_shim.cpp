@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+
+// A drop-in replacement for zlib's CRC-32 entry points, backed by zcrc.
+//
+// Build it with -DZCRC_ZLIB_SHIM=ON, then either link libzcrc-zlib ahead of
+// libz, or inject it into an existing binary with LD_PRELOAD.
+//
+// We deliberately don't include <zlib.h>: the shim must build on systems
+// without zlib, and the declarations below are ABI-compatible with zlib's
+// (uLong = unsigned long, uInt = unsigned int, z_size_t = std::size_t,
+// z_off_t = long, z_off64_t = std::int64_t on every platform we care about).
+
+#include <cstddef>
+#include <cstdint>
+
+#include <zcrc/zcrc.hpp>
+
+#ifdef _WIN32
+#define ZCRC_ZLIB_API __declspec(dllexport)
+#else
+#define ZCRC_ZLIB_API __attribute__((visibility("default")))
+#endif
+
+namespace {
+
+using crc_type = zcrc::crc32_iso_hdlc;
+
+// zlib represents polynomials the same way our reflected CRC state does:
+// the coefficient of x^0 is the most significant bit.
+constexpr std::uint32_t x0 {0x8000'0000};
+
+[[nodiscard]] std::uint32_t x8nmodp(const std::int64_t len) noexcept {
+    return zcrc::detail::process_zero_bytes_fn_impl<crc_type::width, crc_type::poly, crc_type::refin>(
+        x0, static_cast<std::uint64_t>(len < 0 ? 0 : len));
+}
+
+[[nodiscard]] std::uint32_t multmodp(const std::uint32_t lhs, const std::uint32_t rhs) noexcept {
+    return zcrc::detail::clmul_over_field<crc_type::width, crc_type::poly, crc_type::refin>(lhs, rhs);
+}
+
+[[nodiscard]] unsigned long crc32_impl(const unsigned long crc, const unsigned char * const buf, const std::size_t len) noexcept {
+    if (buf == nullptr) {
+        return 0;
+    }
+    return zcrc::finalize(zcrc::process(
+        zcrc::default_algorithm,
+        crc_type {zcrc::from_finalized, static_cast<std::uint32_t>(crc)},
+        buf,
+        buf + len
+    ));
+}
+
+[[nodiscard]] unsigned long crc32_combine_impl(const unsigned long crc1, const unsigned long crc2, const std::int64_t len2) noexcept {
+    return zcrc::finalize(zcrc::combine(
+        zcrc::process_zero_bytes(
+            zcrc::combine(crc_type {zcrc::from_finalized, static_cast<std::uint32_t>(crc1)}, crc_type {}),
+            len2 < 0 ? 0 : len2
+        ),
+        crc_type {zcrc::from_finalized, static_cast<std::uint32_t>(crc2)}
+    ));
+}
+
+} // namespace
+
+extern "C" {
+
+ZCRC_ZLIB_API unsigned long crc32(const unsigned long crc, const unsigned char * const buf, const unsigned int len) {
+    return crc32_impl(crc, buf, len);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_z(const unsigned long crc, const unsigned char * const buf, const std::size_t len) {
+    return crc32_impl(crc, buf, len);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_combine(const unsigned long crc1, const unsigned long crc2, const long len2) {
+    return crc32_combine_impl(crc1, crc2, len2);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_combine64(const unsigned long crc1, const unsigned long crc2, const std::int64_t len2) {
+    return crc32_combine_impl(crc1, crc2, len2);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_combine_gen(const long len2) {
+    return x8nmodp(len2);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_combine_gen64(const std::int64_t len2) {
+    return x8nmodp(len2);
+}
+
+ZCRC_ZLIB_API unsigned long crc32_combine_op(const unsigned long crc1, const unsigned long crc2, const unsigned long op) {
+    return multmodp(static_cast<std::uint32_t>(op), static_cast<std::uint32_t>(crc1)) ^ (crc2 & 0xFFFF'FFFF);
+}
+
+} // extern "C"
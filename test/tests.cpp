@@ -2,13 +2,18 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -23,6 +28,9 @@ import zcrc;
 #endif
 #else
 #include <zcrc/zcrc.hpp>
+#ifdef ZCRC_TEST_ZLIB
+#include <zcrc/zlib.hpp>
+#endif
 #define HEADER_OR_MODULE_TAG "[header]"
 #endif
 
@@ -36,6 +44,8 @@ using namespace std::literals;
 TEST_CASE("compile-time checks", HEADER_OR_MODULE_TAG) {
     CHECK_MATRIX(zcrc::algorithm<zcrc::slice_by_t<0xC0FFEE>>);
     CHECK_MATRIX(zcrc::algorithm<zcrc::parallel_t<zcrc::slice_by_t<0xC0FFEE>>>);
+    CHECK_MATRIX(zcrc::algorithm<zcrc::native_t>);
+    CHECK_MATRIX(zcrc::algorithm<zcrc::parallel_t<zcrc::native_t>>);
     CHECK_MATRIX(zcrc::algorithm<decltype(zcrc::default_algorithm)>);
     CHECK_MATRIX(!zcrc::algorithm<int>);
     CHECK_MATRIX(std::regular_invocable<decltype(zcrc::crc32c::compute), std::vector<char>&>);
@@ -68,7 +78,8 @@ TEMPLATE_TEST_CASE("basic functionality checks", HEADER_OR_MODULE_TAG,
     zcrc::slice_by_t<2>,
     zcrc::slice_by_t<3>,
     zcrc::slice_by_t<4>,
-    zcrc::slice_by_t<5>
+    zcrc::slice_by_t<5>,
+    zcrc::native_t
 ) {
     static constexpr TestType algo {};
     static constexpr std::string_view test_data {"123456789"};
@@ -316,6 +327,37 @@ TEMPLATE_TEST_CASE("basic functionality checks", HEADER_OR_MODULE_TAG,
     CHECK(zcrc::crc64_xz::compute(
         algo, std::ranges::istream_view<char>{stream}) == 0x995DC9BBDF1939FA);
 
+    // Noncontiguous input is processed a block at a time; try lengths around the block size.
+    std::string long_data(10'000, '\0');
+    for (std::size_t i {0}; i < long_data.size(); ++i) {
+        long_data[i] = static_cast<char>((i * i) ^ (i >> 3));
+    }
+    for (const std::size_t len : {4095, 4096, 4097, 8192, 10'000}) {
+        const std::string_view data {std::string_view {long_data}.substr(0, len)};
+        CHECK(zcrc::crc32c::compute(algo, data | std::views::filter([] (char) { return true; })) == zcrc::crc32c::compute(algo, data));
+        CHECK(zcrc::crc16_modbus::compute(algo, data | std::views::transform([] (const char c) { return static_cast<std::byte>(c); })) ==
+              zcrc::crc16_modbus::compute(algo, data));
+    }
+
+    // Wider integers go through zcrc::as_bytes, in either byte order.
+    static constexpr std::array<std::uint32_t, 2> words {0x31323334, 0x39383736};
+    CHECK_MATRIX(zcrc::crc32c::compute(algo, zcrc::as_bytes<std::endian::big>(words)) == zcrc::crc32c::compute(algo, "12349876"sv));
+    CHECK_MATRIX(zcrc::crc32c::compute(algo, zcrc::as_bytes<std::endian::little>(words)) == zcrc::crc32c::compute(algo, "43216789"sv));
+    std::vector<std::int16_t> samples((long_data.size() / 2) + 1);
+    std::string samples_be {};
+    for (std::size_t i {0}; i < samples.size(); ++i) {
+        samples[i] = static_cast<std::int16_t>((i * 40'503) ^ (i >> 2));
+        samples_be += static_cast<char>(static_cast<std::uint16_t>(samples[i]) >> 8);
+        samples_be += static_cast<char>(samples[i]);
+    }
+    const auto samples_view {zcrc::as_bytes<std::endian::big>(samples)};
+    CHECK(samples_view.size() == samples_be.size());
+    CHECK(zcrc::crc32c::compute(algo, samples_view) == zcrc::crc32c::compute(algo, samples_be));
+    CHECK(zcrc::crc32c::compute(algo, std::ranges::next(samples_view.begin(), 3), samples_view.end()) ==
+          zcrc::crc32c::compute(algo, std::string_view {samples_be}.substr(3)));
+    CHECK(zcrc::crc64_xz::compute(algo, zcrc::as_bytes<std::endian::big>(samples | std::views::filter([] (std::int16_t) { return true; }))) ==
+          zcrc::crc64_xz::compute(algo, samples_be));
+
     static constexpr std::array<std::string_view, 4> random_messages {
         "3682BBD37BE6475E08320602B656AF65",
         "9D928182DE7241013877A3850C9BF532",
@@ -373,7 +415,7 @@ TEST_CASE("is_valid", HEADER_OR_MODULE_TAG) {
     CHECK_MATRIX(zcrc::crc16_arc::is_valid("\x33\x22\x55\xAA\xBB\xCC\xDD\xEE\xFF\x98\xAE"sv));
 }
 
-TEMPLATE_TEST_CASE("process_zero_bytes and parallel", HEADER_OR_MODULE_TAG,
+TEMPLATE_TEST_CASE("process_zero_bytes, parallel, and combining", HEADER_OR_MODULE_TAG,
     zcrc::crc3_gsm, zcrc::crc3_rohc, zcrc::crc4_g_704, zcrc::crc4_interlaken,
     zcrc::crc5_epc_c1g2, zcrc::crc5_g_704, zcrc::crc5_usb, zcrc::crc6_cdma2000_a,
     zcrc::crc6_cdma2000_b, zcrc::crc6_darc, zcrc::crc6_g_704, zcrc::crc6_gsm,
@@ -441,6 +483,788 @@ TEMPLATE_TEST_CASE("process_zero_bytes and parallel", HEADER_OR_MODULE_TAG,
         zcrc::process(zcrc::parallel<zcrc::slice_by<1>>, TestType {}, long_message) ==
         zcrc::process(zcrc::slice_by<1>, TestType {}, long_message)
     );
+    // Messages too short to split, whatever the core count, and one long enough to
+    // split on up to nine threads with bytes left over.
+    for (std::size_t len {0}; len <= 100; ++len) {
+        const std::string_view message {long_message.substr(0, len)};
+        CHECK(zcrc::process(zcrc::parallel<zcrc::slice_by<3>>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+    }
+    std::string split_message;
+    while (split_message.size() < ((std::size_t {1} << 14) * 9) + 7) {
+        split_message += long_message;
+    }
+    split_message.resize(((std::size_t {1} << 14) * 9) + 7);
+    CHECK(zcrc::process(zcrc::parallel<zcrc::slice_by<3>>, TestType {}, split_message) ==
+          zcrc::process(zcrc::slice_by<1>, TestType {}, split_message));
+
+    // zcrc::native picks a kernel by length, so try every length around its block
+    // sizes, starting off alignment, as well as a message long enough for every stage.
+    for (std::size_t len {0}; len <= 300; ++len) {
+        CHECK(zcrc::process(zcrc::native, TestType {}, long_message.substr(1, len)) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, long_message.substr(1, len)));
+    }
+    const std::string longer_message {std::string {long_message} + std::string {long_message}};
+    CHECK(zcrc::process(zcrc::native, TestType {}, longer_message) ==
+          zcrc::process(zcrc::slice_by<1>, TestType {}, longer_message));
+    CHECK(zcrc::process(zcrc::parallel<zcrc::native>, TestType {}, longer_message) ==
+          zcrc::process(zcrc::slice_by<1>, TestType {}, longer_message));
+    // Task sizes that do and don't divide the message, and one too big to split it at all.
+    for (const std::string_view message : {long_message, std::string_view {longer_message}, long_message.substr(1)}) {
+        CHECK(zcrc::process(zcrc::parallel<zcrc::slice_by<1>, 64>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+        CHECK(zcrc::process(zcrc::parallel<zcrc::native, 100>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+        CHECK(zcrc::process(zcrc::parallel<zcrc::native, 1 << 20>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+    }
+    // Every remainder a split can leave, whatever the host's core count.
+    for (std::size_t len {0}; len <= 100; ++len) {
+        const std::string_view message {long_message.substr(0, len)};
+        CHECK(zcrc::process(zcrc::parallel<zcrc::slice_by<3>, 3>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+        CHECK(zcrc::process(zcrc::parallel<zcrc::slice_by<3>, 8>, TestType {}, message) ==
+              zcrc::process(zcrc::slice_by<1>, TestType {}, message));
+    }
+    CHECK(zcrc::process(zcrc::numa_parallel<zcrc::native>, TestType {}, longer_message) ==
+          zcrc::process(zcrc::slice_by<1>, TestType {}, longer_message));
+
+    // zcrc::streaming hands its algorithm the input a block at a time.
+    std::string streamed_message {};
+    while (streamed_message.size() < 20'000) {
+        streamed_message += long_message;
+    }
+    for (const std::size_t len : {0, 4095, 8192, 8193, 20'000}) {
+        const std::string_view message {std::string_view {streamed_message}.substr(0, len)};
+        CHECK(zcrc::process(zcrc::streaming<zcrc::native>, TestType {}, message) ==
+              zcrc::process(zcrc::native, TestType {}, message));
+    }
+    CHECK(zcrc::process(zcrc::parallel<zcrc::streaming<zcrc::slice_by<8>, 64>>, TestType {}, streamed_message) ==
+          zcrc::process(zcrc::slice_by<1>, TestType {}, streamed_message));
+
+    CHECK_MATRIX(
+        zcrc::finalize(TestType {zcrc::from_finalized, TestType::compute("123456789"sv)}) ==
+        TestType::compute("123456789"sv)
+    );
+    CHECK_MATRIX(
+        zcrc::process(TestType {zcrc::from_finalized, TestType::compute("1234"sv)}, "56789"sv) ==
+        zcrc::process(TestType {}, "123456789"sv)
+    );
+
+    static constexpr auto chunk_crcs {[] {
+        std::array<typename TestType::crc_type, 3> chunk_crcs_ {};
+        TestType::compute_chunked("123456789"sv, 4, chunk_crcs_);
+        return chunk_crcs_;
+    }()};
+    CHECK_MATRIX(TestType::combine_chunked(chunk_crcs, 4, 9) == TestType::compute("123456789"sv));
+
+    CHECK_MATRIX(zcrc::compose(std::array {
+        std::pair {TestType {zcrc::from_finalized, TestType::compute("1234"sv)}, 4},
+        std::pair {zcrc::process(TestType {}, "5"sv), 1},
+        std::pair {TestType {}, 0},
+        std::pair {zcrc::process(TestType {}, "6789"sv), 4},
+    }) == zcrc::process(TestType {}, "123456789"sv));
+    CHECK_MATRIX(zcrc::compose(std::array<std::pair<TestType, int>, 0> {}) == TestType {});
+}
+
+TEMPLATE_TEST_CASE("process_repeated", HEADER_OR_MODULE_TAG,
+    zcrc::crc3_gsm, zcrc::crc5_usb, zcrc::crc8_smbus, zcrc::crc12_umts,
+    zcrc::crc16_kermit, zcrc::crc16_xmodem, zcrc::crc24_openpgp, zcrc::crc32c,
+    zcrc::crc32_mpeg2, zcrc::crc40_gsm, zcrc::crc64_ecma_182, zcrc::crc64_xz
+) {
+    // Ensure process_repeated runs in logarithmic time.
+    CHECK_MATRIX(((void)zcrc::process_repeated(TestType {}, "\xFF\x00\x5A"sv, std::numeric_limits<std::size_t>::max()), true));
+
+    static constexpr TestType start {zcrc::process(TestType {}, "123456789"sv)};
+    []<std::size_t... N>(std::index_sequence<N...>){
+        (CHECK_MATRIX(
+            zcrc::process_repeated(start, '\xFF', N) ==
+            zcrc::process(start, [] { std::array<char, N> a {}; a.fill('\xFF'); return a; }())
+        ), ...);
+        (CHECK_MATRIX(
+            zcrc::process_repeated(start, std::uint8_t {0}, N) == zcrc::process_zero_bytes(start, N)
+        ), ...);
+    }(std::make_index_sequence<20>{});
+
+    for (std::size_t n {0}; n <= 20; ++n) {
+        std::string message {};
+        for (std::size_t i {0}; i < n; ++i) {
+            message += "DEADBEEF";
+        }
+        CHECK(zcrc::process_repeated(start, "DEADBEEF"sv, n) == zcrc::process(start, message));
+    }
+    CHECK_MATRIX(zcrc::process_repeated(start, ""sv, 1000) == start);
+}
+
+TEST_CASE("chunked", HEADER_OR_MODULE_TAG) {
+    // 5 chunks of 7 bytes followed by a partial chunk of 3.
+    static constexpr std::string_view message {"The quick brown fox jumps over the lazy dog"};
+    static_assert(message.size() == (6 * 7) + 1);
+    static constexpr std::string_view shorter {message.substr(0, (5 * 7) + 3)};
+
+    static constexpr auto crcs {[] {
+        std::array<std::uint32_t, 6> crcs_ {};
+        zcrc::crc32c::compute_chunked(shorter, 7, crcs_);
+        return crcs_;
+    }()};
+
+    CHECK_MATRIX(std::ranges::equal(crcs, std::views::iota(0U, 6U) | std::views::transform([] (const auto i) {
+        return zcrc::crc32c::compute(shorter.substr(i * 7, 7));
+    })));
+    CHECK_MATRIX(zcrc::crc32c::verify_chunked(shorter, 7, crcs) == 6);
+    CHECK_MATRIX(zcrc::crc32c::combine_chunked(crcs, 7, shorter.size()) == zcrc::crc32c::compute(shorter));
+    CHECK_MATRIX(zcrc::crc32c::combine_chunked(std::array<std::uint32_t, 0> {}, 7, 0) == zcrc::crc32c::compute(""sv));
+
+    std::array<std::uint32_t, 6> parallel_crcs {};
+    zcrc::crc32c::compute_chunked(zcrc::parallel<zcrc::slice_by<2>>, shorter, 7, parallel_crcs);
+    CHECK(parallel_crcs == crcs);
+
+    std::string corrupted {shorter};
+    corrupted[37] ^= 1;
+    CHECK(zcrc::crc32c::verify_chunked(corrupted, 7, crcs) == 5);
+    corrupted[15] ^= 1;
+    CHECK(zcrc::crc32c::verify_chunked(zcrc::parallel<zcrc::slice_by<2>>, corrupted, 7, crcs) == 2);
+}
+
+TEST_CASE("multipart", HEADER_OR_MODULE_TAG) {
+    static constexpr std::array parts {"The quick "sv, "brown fox jumps "sv, ""sv, "over "sv, "the lazy dog"sv, "."sv};
+    static constexpr auto crcs {[] {
+        std::array<std::uint32_t, parts.size()> crcs_ {};
+        std::ranges::transform(parts, crcs_.begin(), zcrc::crc32c::compute);
+        return crcs_;
+    }()};
+    static constexpr auto corrupted {[] {
+        auto crcs_ {crcs};
+        crcs_[4] ^= 1;
+        return crcs_;
+    }()};
+
+    CHECK_MATRIX(zcrc::crc32c::verify_parts(parts, crcs) == parts.size());
+    CHECK_MATRIX(zcrc::crc32c::verify_parts(parts, corrupted) == 4);
+    CHECK(zcrc::crc32c::verify_parts(zcrc::parallel<zcrc::slice_by<3>>, parts, crcs) == parts.size());
+    CHECK(zcrc::crc32c::verify_parts(zcrc::parallel<zcrc::slice_by<3>>, parts, corrupted) == 4);
+
+    static constexpr auto composed {[] {
+        std::array<std::pair<zcrc::crc32c, std::size_t>, parts.size()> parts_ {};
+        for (std::size_t i {0}; i < parts.size(); ++i) {
+            parts_[i] = {zcrc::crc32c {zcrc::from_finalized, crcs[i]}, parts[i].size()};
+        }
+        return zcrc::finalize(zcrc::compose(parts_));
+    }()};
+    CHECK_MATRIX(composed == zcrc::crc32c::compute("The quick brown fox jumps over the lazy dog."sv));
+}
+
+TEST_CASE("frames", HEADER_OR_MODULE_TAG) {
+    // 70 frames of assorted lengths, each followed by its FCS (least significant byte
+    // first, as on the wire), with frames 3 and 66 corrupted.
+    static constexpr auto check {[] (const auto algo) {
+        std::vector<std::vector<std::uint8_t>> frames;
+        for (std::size_t i {0}; i < 70; ++i) {
+            std::vector<std::uint8_t> frame;
+            for (std::size_t j {0}; j < (i * 7) % 31; ++j) {
+                frame.push_back(static_cast<std::uint8_t>(i + j));
+            }
+            const std::uint32_t fcs {zcrc::crc32_iso_hdlc::compute(frame)};
+            for (std::size_t j {0}; j < 4; ++j) {
+                frame.push_back(static_cast<std::uint8_t>(fcs >> (8 * j)));
+            }
+            frames.push_back(std::move(frame));
+        }
+        frames[3][1] ^= 0x10;
+        frames[66].back() ^= 0x80;
+
+        std::array<std::uint64_t, 2> bitmap {};
+        const std::size_t valid {zcrc::crc32_iso_hdlc::verify_frames(algo, frames, bitmap)};
+        return std::tuple {valid, bitmap[0], bitmap[1]};
+    }};
+
+    constexpr std::tuple expected {std::size_t {68}, ~std::uint64_t {0} ^ (std::uint64_t {1} << 3), 0x3FULL ^ (std::uint64_t {1} << 2)};
+    CHECK_MATRIX(check(zcrc::default_algorithm) == expected);
+    CHECK(check(zcrc::parallel<zcrc::slice_by<4>>) == expected);
+    CHECK(check(zcrc::slice_by<1>) == expected);
+}
+
+TEMPLATE_TEST_CASE("process_bits", HEADER_OR_MODULE_TAG,
+    zcrc::crc3_gsm, zcrc::crc4_g_704, zcrc::crc15_can, zcrc::crc16_kermit, zcrc::crc21_can_fd) {
+    // Packs [bits] into bytes in the order the CRC consumes them.
+    static constexpr auto pack {[] (const std::vector<bool>& bits) {
+        std::vector<std::uint8_t> bytes((bits.size() + 7) / 8);
+        for (std::size_t i {0}; i < bits.size(); ++i) {
+            if (bits[i]) {
+                bytes[i / 8] |= static_cast<std::uint8_t>(TestType::refin ? 1 << (i % 8) : 0x80 >> (i % 8));
+            }
+        }
+        return bytes;
+    }};
+
+    // Starting from zero, leading zero bits don't change the CRC, so padding the front
+    // of a message out to a whole number of bytes gives one that process can handle.
+    CHECK_MATRIX([] {
+        std::vector<bool> bits;
+        for (std::size_t n {0}; n < 45; ++n) {
+            const std::uint64_t bit_count {bits.size()};
+            std::vector<bool> padded((8 - (bit_count % 8)) % 8, false);
+            padded.insert(padded.end(), bits.begin(), bits.end());
+            if (zcrc::process_bits(TestType {zcrc::zero_init}, pack(bits), bit_count) !=
+                zcrc::process(TestType {zcrc::zero_init}, pack(padded))) {
+                return false;
+            }
+            bits.push_back(((n * 37) + 11) % 7 < 3);
+        }
+        return true;
+    }());
+
+    CHECK_MATRIX(zcrc::process_bits(TestType {}, "123456789"sv, 72) == zcrc::process(TestType {}, "123456789"sv));
+    CHECK(zcrc::process_bits(zcrc::slice_by<4>, TestType {}, "123456789"sv, 69) == zcrc::process_bits(TestType {}, "123456789"sv, 69));
+
+    // Frames with their CRC appended bit by bit, as on a CAN bus, with the fourth corrupted.
+    static constexpr auto check {[] (const auto algo) {
+        std::vector<std::pair<std::vector<std::uint8_t>, std::size_t>> frames;
+        for (std::size_t n {1}; n < 40; n += 3) {
+            std::vector<bool> bits;
+            for (std::size_t i {0}; i < n; ++i) {
+                bits.push_back(((i * 13) + n) % 5 < 2);
+            }
+            const auto result {zcrc::finalize(zcrc::process_bits(TestType {}, pack(bits), n))};
+            for (std::size_t i {0}; i < TestType::width; ++i) {
+                bits.push_back(((result >> (TestType::refout ? i : TestType::width - i - 1)) & 1) != 0);
+            }
+            frames.emplace_back(pack(bits), bits.size());
+        }
+        frames[3].first[0] ^= 0x20;
+
+        std::array<std::uint64_t, 1> bitmap {};
+        const std::size_t valid {TestType::verify_frames(algo, frames, bitmap)};
+        return std::pair {valid, bitmap[0]};
+    }};
+    CHECK_MATRIX(check(zcrc::default_algorithm) == std::pair {std::size_t {12}, std::uint64_t {0x1FF7}});
+    CHECK(check(zcrc::slice_by<1>) == std::pair {std::size_t {12}, std::uint64_t {0x1FF7}});
+}
+
+TEST_CASE("posix_cksum", HEADER_OR_MODULE_TAG) {
+    // Expected values are from GNU cksum.
+    CHECK_MATRIX(zcrc::posix_cksum(""sv) == 4294967295);
+    CHECK_MATRIX(zcrc::posix_cksum("123456789"sv) == 930766865);
+    CHECK_MATRIX(zcrc::posix_cksum(std::string(300, 'a')) == 1664553091);
+    CHECK(zcrc::posix_cksum(zcrc::parallel<zcrc::slice_by<8>>, std::string(300, 'a')) == 1664553091);
+    CHECK_MATRIX(zcrc::posix_cksum(zcrc::process(zcrc::process(zcrc::crc32_cksum {}, "1234"sv), "56789"sv), 9) == 930766865);
+}
+
+TEMPLATE_TEST_CASE("gf2", HEADER_OR_MODULE_TAG,
+    zcrc::crc3_gsm, zcrc::crc5_usb, zcrc::crc16_kermit, zcrc::crc16_xmodem,
+    zcrc::crc32c, zcrc::crc32_mpeg2, zcrc::crc64_ecma_182, zcrc::crc64_xz) {
+    namespace gf2 = zcrc::gf2;
+    using T = typename TestType::crc_type;
+    constexpr T a {static_cast<T>(0x9E3779B97F4A7C15 >> (64 - TestType::width))};
+    constexpr T b {static_cast<T>(0xC2B2AE3D27D4EB4F >> (64 - TestType::width))};
+
+    CHECK_MATRIX(gf2::mulmod<TestType>(a, gf2::xpow<TestType>(0)) == a);
+    CHECK_MATRIX(gf2::mulmod<TestType>(a, b) == gf2::mulmod<TestType>(b, a));
+    CHECK_MATRIX(gf2::reduce<TestType>(gf2::clmul(a, b)) == gf2::mulmod<TestType>(a, b));
+    CHECK(gf2::reduce<TestType>(gf2::clmul(a, b)) == gf2::mulmod<TestType>(a, b));
+    CHECK_MATRIX(gf2::mulmod<TestType>(gf2::xpow<TestType>(1000), gf2::xpow<TestType>(~std::uint64_t {1000})) ==
+                 gf2::xpow<TestType>(~std::uint64_t {0}));
+    CHECK_MATRIX(gf2::powmod<TestType>(gf2::xpow<TestType>(3), 12345) == gf2::xpow<TestType>(3 * 12345));
+    CHECK(gf2::powmod<TestType>(a, 77) == gf2::mulmod<TestType>(gf2::powmod<TestType>(a, 70), gf2::powmod<TestType>(a, 7)));
+    CHECK_MATRIX(gf2::fold_constant<TestType>(200) == (TestType::refin
+        ? std::uint64_t {gf2::xpow<TestType>(199)} << (64 - TestType::width)
+        : std::uint64_t {gf2::xpow<TestType>(200)}));
+}
+
+TEST_CASE("gf2 against known values", HEADER_OR_MODULE_TAG) {
+    // From the PCLMULQDQ paper: floor(x^64 / P) for CRC-32, and the same, reflected.
+    CHECK_MATRIX(zcrc::gf2::barrett_constant<zcrc::crc32_mpeg2> == 0x04D101DF);
+    CHECK_MATRIX(zcrc::gf2::barrett_constant<zcrc::crc32_iso_hdlc> == 0xFB808B20);
+
+    // With no initial value or final XOR, a CRC is just the message times x^Width mod P,
+    // so appending five bytes multiplies it by x^40.
+    CHECK_MATRIX((zcrc::gf2::mulmod<zcrc::crc16_xmodem>(zcrc::crc16_xmodem::compute("1234"sv), zcrc::gf2::xpow<zcrc::crc16_xmodem>(40)) ^
+                  zcrc::crc16_xmodem::compute("56789"sv)) == zcrc::crc16_xmodem::compute("123456789"sv));
+    CHECK_MATRIX((zcrc::gf2::mulmod<zcrc::crc16_kermit>(zcrc::crc16_kermit::compute("1234"sv), zcrc::gf2::xpow<zcrc::crc16_kermit>(40)) ^
+                  zcrc::crc16_kermit::compute("56789"sv)) == zcrc::crc16_kermit::compute("123456789"sv));
+}
+
+TEST_CASE("protection information", HEADER_OR_MODULE_TAG) {
+    // 9 sectors of 7 bytes: enough for two full groups of lanes plus a remainder.
+    static constexpr std::string_view buffer {"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!"};
+    static_assert(buffer.size() == 9 * 7);
+
+    const auto test {[]<typename CRC, typename Tag> {
+        static constexpr auto tags {[] {
+            std::array<Tag, 9> tags_ {};
+            zcrc::pi::generate(buffer, 7, tags_);
+            return tags_;
+        }()};
+        static constexpr auto corrupted {[] {
+            auto tags_ {tags};
+            tags_[5] ^= 1;
+            return tags_;
+        }()};
+
+        CHECK_MATRIX(std::ranges::equal(tags, std::views::iota(0U, 9U) | std::views::transform([] (const auto i) {
+            return CRC::compute(buffer.substr(i * 7, 7));
+        })));
+        CHECK_MATRIX(zcrc::pi::verify(buffer, 7, tags) == 9);
+        CHECK_MATRIX(zcrc::pi::verify(buffer, 7, corrupted) == 5);
+
+        std::array<Tag, 9> parallel_tags {};
+        zcrc::pi::generate(zcrc::parallel<zcrc::slice_by<3>>, buffer, 7, parallel_tags);
+        CHECK(parallel_tags == tags);
+        CHECK(zcrc::pi::verify(zcrc::parallel<zcrc::slice_by<3>>, buffer, 7, tags) == 9);
+        CHECK(zcrc::pi::verify(zcrc::parallel<zcrc::slice_by<3>>, buffer, 7, corrupted) == 5);
+    }};
+
+    test.template operator()<zcrc::crc16_t10_dif, std::uint16_t>();
+    test.template operator()<zcrc::crc32c, std::uint32_t>();
+    test.template operator()<zcrc::crc64_nvme, std::uint64_t>();
+}
+
+TEST_CASE("masked CRC32C and record streams", HEADER_OR_MODULE_TAG) {
+    CHECK_MATRIX(zcrc::masked_crc32c::compute("123456789"sv) == 0xC78AB0E5);
+    CHECK_MATRIX(zcrc::masked_crc32c::mask(0xE3069283) == 0xC78AB0E5);
+    CHECK_MATRIX(zcrc::masked_crc32c::unmask(0xC78AB0E5) == 0xE3069283);
+
+    const auto append_le {[] (std::string& s, std::uint64_t value, const std::size_t bytes) {
+        for (std::size_t i {0}; i < bytes; ++i, value >>= 8) {
+            s += static_cast<char>(value & 0xFF);
+        }
+    }};
+
+    SECTION("TFRecord") {
+        // Six records of assorted lengths: one full group of lanes plus a remainder.
+        std::string stream;
+        std::vector<std::size_t> offsets;
+        for (const std::size_t len : {0, 5, 30, 31, 3, 100}) {
+            offsets.push_back(stream.size());
+            std::string length;
+            append_le(length, len, 8);
+            const std::string data(len, static_cast<char>('a' + len % 26));
+            stream += length;
+            append_le(stream, zcrc::masked_crc32c::compute(length), 4);
+            stream += data;
+            append_le(stream, zcrc::masked_crc32c::compute(data), 4);
+        }
+
+        CHECK(zcrc::tfrecord::verify(stream) == stream.size());
+        CHECK(zcrc::tfrecord::verify(zcrc::parallel<zcrc::slice_by<3>>, stream) == stream.size());
+        CHECK(zcrc::tfrecord::verify(""sv) == 0);
+
+        auto corrupted_data {stream};
+        corrupted_data[offsets[4] + 13] ^= 1;
+        CHECK(zcrc::tfrecord::verify(corrupted_data) == offsets[4]);
+        CHECK(zcrc::tfrecord::verify(zcrc::parallel<zcrc::slice_by<3>>, corrupted_data) == offsets[4]);
+
+        auto corrupted_length {stream};
+        corrupted_length[offsets[2]] ^= 1;
+        CHECK(zcrc::tfrecord::verify(corrupted_length) == offsets[2]);
+
+        CHECK(zcrc::tfrecord::verify(std::string_view {stream}.substr(0, stream.size() - 1)) == offsets[5]);
+    }
+
+    SECTION("LevelDB log") {
+        std::string log;
+        std::vector<std::size_t> offsets;
+        const auto append_record {[&] (const std::uint8_t type, const std::string_view data) {
+            offsets.push_back(log.size());
+            std::string covered {static_cast<char>(type)};
+            if (type >= 5) {
+                append_le(covered, 42, 4);
+            }
+            covered += data;
+            append_le(log, zcrc::masked_crc32c::compute(covered), 4);
+            append_le(log, data.size(), 2);
+            log += covered;
+        }};
+
+        append_record(1, "hello");
+        append_record(2, std::string(32768 - 12 - 7 - 3, 'x'));
+        log += "\0\0\0"sv; // Block trailer.
+        append_record(4, "world");
+        append_record(5, "recycled");
+        append_record(1, "");
+        log += std::string(64, '\0'); // Preallocated space.
+
+        CHECK(zcrc::leveldb::verify_log(log) == log.size());
+        CHECK(zcrc::leveldb::verify_log(zcrc::parallel<zcrc::slice_by<3>>, log) == log.size());
+
+        auto corrupted {log};
+        corrupted[offsets[3] + 12] ^= 1;
+        CHECK(zcrc::leveldb::verify_log(corrupted) == offsets[3]);
+
+        CHECK(zcrc::leveldb::verify_log(std::string_view {log}.substr(0, offsets[4] + 3)) == offsets[4]);
+    }
+
+    SECTION("Kafka") {
+        const auto append_be {[] (std::string& s, const std::uint64_t value, const std::size_t bytes) {
+            for (std::size_t i {bytes}; i-- > 0;) {
+                s += static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+        }};
+
+        std::string records;
+        std::vector<zcrc::kafka::batch> batches;
+        const auto append_batch {[&] (const std::uint8_t magic, const std::string_view payload) {
+            const std::size_t offset {records.size()};
+            append_be(records, batches.size(), 8);   // Base offset
+            std::string covered;
+            if (magic == 2) {
+                covered = std::string(40, '\0');     // Attributes through record count
+                covered += payload;
+                append_be(records, 9 + covered.size(), 4);
+                append_be(records, 0, 4);            // Partition leader epoch
+                records += '\x02';
+                append_be(records, zcrc::crc32c::compute(covered), 4);
+            } else {
+                covered = {static_cast<char>(magic), '\0'};
+                covered += std::string(magic == 1 ? 8 : 0, '\0'); // Timestamp
+                append_be(covered, 0xFFFF'FFFF, 4);  // Null key
+                append_be(covered, payload.size(), 4);
+                covered += payload;
+                append_be(records, 4 + covered.size(), 4);
+                append_be(records, zcrc::crc32_iso_hdlc::compute(covered), 4);
+            }
+            records += covered;
+            batches.push_back({offset, records.size() - offset, true});
+        }};
+
+        // Enough batches of assorted lengths for a full group of lanes plus a remainder.
+        append_batch(2, "a");
+        append_batch(0, "legacy");
+        append_batch(2, std::string(200, 'b'));
+        append_batch(1, "legacy with a timestamp");
+        for (std::size_t i {0}; i < 6; ++i) {
+            append_batch(2, std::string(i * 7, 'c'));
+        }
+
+        CHECK(zcrc::kafka::verify(records) == batches);
+        CHECK(zcrc::kafka::verify(zcrc::parallel<zcrc::slice_by<3>>, records) == batches);
+        CHECK(zcrc::kafka::verify(""sv).empty());
+
+        auto corrupted {records};
+        corrupted[batches[2].offset + batches[2].size - 1] ^= 1;
+        corrupted[batches[3].offset + 17] ^= 1;
+        auto expected {batches};
+        expected[2].intact = false;
+        expected[3].intact = false;
+        CHECK(zcrc::kafka::verify(corrupted) == expected);
+        CHECK(zcrc::kafka::verify(zcrc::parallel<zcrc::slice_by<3>>, corrupted) == expected);
+
+        // A fetch response may end partway through a batch.
+        CHECK(zcrc::kafka::verify(std::string_view {records}.substr(0, records.size() - 1)) ==
+              std::vector(batches.begin(), batches.end() - 1));
+    }
+}
+
+TEST_CASE("containers", HEADER_OR_MODULE_TAG) {
+    const auto append_le {[] (std::string& s, std::uint64_t value, const std::size_t bytes) {
+        for (std::size_t i {0}; i < bytes; ++i, value >>= 8) {
+            s += static_cast<char>(value & 0xFF);
+        }
+    }};
+
+    // Understands only deflate's stored blocks, which is all we need to build test archives by hand.
+    const auto stored_inflate {[] (const std::span<const unsigned char> in, auto&& out) -> std::optional<std::size_t> {
+        for (std::size_t offset {0}; in.size() - offset >= 5 && (in[offset] & 0x06) == 0;) {
+            const std::size_t len {in[offset + 1] | (std::size_t {in[offset + 2]} << 8)};
+            if (in.size() - offset - 5 < len) {
+                break;
+            }
+            out(in.subspan(offset + 5, len));
+            offset += 5 + len;
+            if ((in[offset - 5 - len] & 1) != 0) {
+                return offset;
+            }
+        }
+        return std::nullopt;
+    }};
+    const auto deflate_stored {[&] (const std::string_view data) {
+        std::string out;
+        for (const auto& [block, final] : {std::pair {data.substr(0, data.size() / 2), false}, std::pair {data.substr(data.size() / 2), true}}) {
+            out += static_cast<char>(final);
+            append_le(out, block.size(), 2);
+            append_le(out, ~block.size(), 2);
+            out += block;
+        }
+        return out;
+    }};
+
+    SECTION("PNG") {
+        std::string png {"\x89PNG\r\n\x1A\n"};
+        std::vector<std::size_t> offsets;
+        for (const auto& [type, data] : {std::pair {"IHDR"sv, "\0\0\0\1\0\0\0\1\x08\x02\0\0\0"sv}, std::pair {"IDAT"sv, "pixels"sv}, std::pair {"IEND"sv, ""sv}}) {
+            offsets.push_back(png.size());
+            for (std::size_t i {4}; i-- > 0;) {
+                png += static_cast<char>((data.size() >> (8 * i)) & 0xFF);
+            }
+            const std::string covered {std::string {type} + std::string {data}};
+            png += covered;
+            for (std::size_t i {4}; i-- > 0;) {
+                png += static_cast<char>((zcrc::crc32_iso_hdlc::compute(covered) >> (8 * i)) & 0xFF);
+            }
+        }
+        CHECK(png.ends_with("IEND\xAE\x42\x60\x82"sv));
+
+        CHECK(zcrc::png::verify(png).empty());
+        CHECK(zcrc::png::verify(zcrc::parallel<zcrc::slice_by<3>>, png).empty());
+        CHECK(zcrc::png::verify("GIF89a"sv) == std::vector<std::size_t> {0});
+
+        auto corrupted {png};
+        corrupted[offsets[1] + 9] ^= 1;
+        corrupted[offsets[2] + 9] ^= 1;
+        CHECK(zcrc::png::verify(corrupted) == std::vector {offsets[1], offsets[2]});
+        CHECK(zcrc::png::verify(std::string_view {png}.substr(0, offsets[2] + 3)) == std::vector {offsets[2]});
+    }
+
+    SECTION("zip") {
+        std::string zip;
+        std::string directory;
+        std::vector<std::size_t> offsets;
+        for (const auto& [name, data, method] : {
+            std::tuple {"stored.txt"sv, "The quick brown fox"sv, 0},
+            std::tuple {"deflated.txt"sv, "jumps over the lazy dog"sv, 8},
+            std::tuple {"unknown.txt"sv, "?"sv, 99},
+            std::tuple {"empty.txt"sv, ""sv, 0},
+        }) {
+            const std::string compressed {method == 8 ? deflate_stored(data) : std::string {data}};
+            const std::uint32_t crc {zcrc::crc32_iso_hdlc::compute(data)};
+            offsets.push_back(zip.size());
+
+            std::string header;
+            append_le(header, 20, 2);                // Version needed
+            append_le(header, 0, 2);                 // Flags
+            append_le(header, method, 2);
+            append_le(header, 0, 4);                 // Time and date
+            append_le(header, crc, 4);
+            append_le(header, compressed.size(), 4);
+            append_le(header, data.size(), 4);
+            append_le(header, name.size(), 2);
+            append_le(header, 0, 2);                 // Extra field length
+
+            append_le(zip, 0x04034B50, 4);
+            zip += header;
+            zip += name;
+            zip += compressed;
+
+            append_le(directory, 0x02014B50, 4);
+            append_le(directory, 20, 2);             // Version made by
+            directory += header;
+            append_le(directory, 0, 2);              // Comment length
+            append_le(directory, 0, 2);              // Disk number
+            append_le(directory, 0, 2);              // Internal attributes
+            append_le(directory, 0, 4);              // External attributes
+            append_le(directory, offsets.back(), 4);
+            directory += name;
+        }
+        const std::size_t directory_offset {zip.size()};
+        zip += directory;
+        append_le(zip, 0x06054B50, 4);
+        append_le(zip, 0, 4);                        // Disk numbers
+        append_le(zip, offsets.size(), 2);
+        append_le(zip, offsets.size(), 2);
+        append_le(zip, directory.size(), 4);
+        append_le(zip, directory_offset, 4);
+        append_le(zip, 0, 2);                        // Comment length
+
+        CHECK(zcrc::zip::verify(zip).empty());
+        CHECK(zcrc::zip::verify(zip, stored_inflate).empty());
+        CHECK(zcrc::zip::verify(zcrc::parallel<zcrc::slice_by<3>>, zip, stored_inflate).empty());
+        CHECK(zcrc::zip::verify("not a zip"sv) == std::vector<std::size_t> {9});
+
+        auto corrupted {zip};
+        corrupted[offsets[1] - 1] ^= 1;
+        corrupted[offsets[2] - 1] ^= 1;
+        CHECK(zcrc::zip::verify(corrupted) == std::vector {offsets[0]});
+        CHECK(zcrc::zip::verify(corrupted, stored_inflate) == std::vector {offsets[0], offsets[1]});
+        CHECK(zcrc::zip::verify(zcrc::parallel<zcrc::slice_by<3>>, corrupted, stored_inflate) == std::vector {offsets[0], offsets[1]});
+    }
+
+    SECTION("gzip") {
+        std::string gzip;
+        std::vector<std::size_t> offsets;
+        for (const auto& [data, name] : {std::pair {"The quick brown fox "sv, ""sv}, std::pair {"jumps over the lazy dog"sv, "fox.txt"sv}}) {
+            offsets.push_back(gzip.size());
+            gzip += "\x1F\x8B\x08"sv;
+            gzip += static_cast<char>(name.empty() ? 0 : 0x08 | 0x02); // FNAME | FHCRC
+            append_le(gzip, 0, 4);                   // MTIME
+            gzip += "\0\xFF"sv;                      // XFL, OS
+            if (!name.empty()) {
+                gzip += name;
+                gzip += '\0';
+                append_le(gzip, zcrc::crc32_iso_hdlc::compute(std::string_view {gzip}.substr(offsets.back())), 2);
+            }
+            gzip += deflate_stored(data);
+            append_le(gzip, zcrc::crc32_iso_hdlc::compute(data), 4);
+            append_le(gzip, data.size(), 4);
+        }
+
+        CHECK(zcrc::gzip::verify(gzip, stored_inflate).empty());
+        CHECK(zcrc::gzip::verify(zcrc::parallel<zcrc::slice_by<3>>, gzip, stored_inflate).empty());
+
+        auto corrupted {gzip};
+        corrupted[offsets[1] - 9] ^= 1;
+        corrupted[offsets[1] + 12] ^= 1;
+        CHECK(zcrc::gzip::verify(corrupted, stored_inflate) == std::vector {offsets[0], offsets[1]});
+        CHECK(zcrc::gzip::verify(zcrc::parallel<zcrc::slice_by<3>>, corrupted, stored_inflate) == std::vector {offsets[0], offsets[1]});
+        CHECK(zcrc::gzip::verify(std::string_view {gzip}.substr(0, gzip.size() - 1), stored_inflate) == std::vector {offsets[1]});
+    }
+
+    SECTION("Parquet") {
+        // Thrift's compact protocol, as far as the page headers and footer need it.
+        const auto varint {[] (std::string& s, std::uint64_t value) {
+            for (; value >= 0x80; value >>= 7) {
+                s += static_cast<char>((value & 0x7F) | 0x80);
+            }
+            s += static_cast<char>(value);
+        }};
+        const auto zigzag {[&] (std::string& s, const std::int64_t value) {
+            varint(s, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        }};
+        const auto field {[] (std::string& s, std::int64_t& last, const std::int64_t id, const int type) {
+            s += static_cast<char>(((id - last) << 4) | type);
+            last = id;
+        }};
+
+        std::string parquet {"PAR1"};
+        std::vector<std::size_t> pages;
+        const auto page {[&] (const std::string_view data, const bool with_crc) {
+            pages.push_back(parquet.size());
+            std::int64_t last {0};
+            field(parquet, last, 1, 5);
+            zigzag(parquet, 0);                      // type: DATA_PAGE
+            field(parquet, last, 2, 5);
+            zigzag(parquet, static_cast<std::int64_t>(data.size()));
+            field(parquet, last, 3, 5);
+            zigzag(parquet, static_cast<std::int64_t>(data.size()));
+            if (with_crc) {
+                field(parquet, last, 4, 5);
+                zigzag(parquet, static_cast<std::int32_t>(zcrc::crc32_iso_hdlc::compute(data)));
+            }
+            field(parquet, last, 5, 12);             // data_page_header, which we skip
+            std::int64_t inner {0};
+            field(parquet, inner, 1, 5);
+            zigzag(parquet, 1);
+            field(parquet, inner, 3, 8);
+            varint(parquet, 3);
+            parquet += "abc\0\0"sv;
+            parquet += data;
+        }};
+
+        std::vector<std::pair<std::size_t, std::size_t>> chunks;
+        for (const auto& chunk : {std::vector {"The quick brown fox"sv, "jumps over"sv}, std::vector {"the lazy dog"sv}}) {
+            const std::size_t begin {parquet.size()};
+            for (std::size_t i {0}; i < chunk.size(); ++i) {
+                page(chunk[i], i == 0);
+            }
+            chunks.emplace_back(begin, parquet.size() - begin);
+        }
+
+        std::string footer;
+        std::int64_t last {0};
+        field(footer, last, 1, 5);
+        zigzag(footer, 2);                           // version
+        field(footer, last, 2, 9);
+        footer += '\x0C';                            // schema: an empty list
+        field(footer, last, 3, 6);
+        zigzag(footer, 3);                           // num_rows
+        field(footer, last, 4, 9);
+        footer += '\x1C';                            // row_groups: one struct
+        std::int64_t row_group {0};
+        field(footer, row_group, 1, 9);
+        footer += static_cast<char>(((chunks.size() + 1) << 4) | 12);
+        for (std::size_t i {0}; i <= chunks.size(); ++i) {
+            // The last column chunk is in another file, so it isn't checked.
+            const auto [offset, size] {i < chunks.size() ? chunks[i] : std::pair {std::size_t {1'000'000}, std::size_t {10}}};
+            std::int64_t column {0};
+            if (i == chunks.size()) {
+                field(footer, column, 1, 8);
+                varint(footer, 5);
+                footer += "other"sv;
+            }
+            field(footer, column, 2, 6);
+            zigzag(footer, static_cast<std::int64_t>(offset));
+            field(footer, column, 3, 12);
+            std::int64_t meta {0};
+            field(footer, meta, 1, 5);
+            zigzag(footer, 6);                       // type: BYTE_ARRAY
+            field(footer, meta, 7, 6);
+            zigzag(footer, static_cast<std::int64_t>(size));
+            field(footer, meta, 9, 6);
+            zigzag(footer, static_cast<std::int64_t>(offset));
+            footer += "\0\0"sv;
+        }
+        field(footer, row_group, 2, 6);
+        zigzag(footer, 100);                         // total_byte_size
+        footer += "\0\0"sv;
+        parquet += footer;
+        append_le(parquet, footer.size(), 4);
+        parquet += "PAR1"sv;
+
+        CHECK(zcrc::parquet::verify(parquet).empty());
+        CHECK(zcrc::parquet::verify(zcrc::parallel<zcrc::slice_by<3>>, parquet).empty());
+        CHECK(zcrc::parquet::verify(parquet, chunks).empty());
+        CHECK(zcrc::parquet::verify("not a Parquet file"sv) == std::vector<std::size_t> {0});
+
+        auto corrupted {parquet};
+        corrupted[pages[1] - 1] ^= 1;
+        corrupted[pages[2] - 1] ^= 1;                // The second page has no CRC.
+        corrupted[chunks[1].first + chunks[1].second - 1] ^= 1;
+        CHECK(zcrc::parquet::verify(corrupted) == std::vector {pages[0], pages[2]});
+        CHECK(zcrc::parquet::verify(zcrc::parallel<zcrc::slice_by<3>>, corrupted) == std::vector {pages[0], pages[2]});
+        CHECK(zcrc::parquet::verify(corrupted, std::array {chunks[1]}) == std::vector {pages[2]});
+        CHECK(zcrc::parquet::verify(parquet, std::array {std::pair {chunks[0].first, chunks[0].second - 1}}) == std::vector {pages[1]});
+
+        corrupted = parquet;
+        corrupted[parquet.size() - 10] ^= 0x80;      // Breaks the footer's final stop field.
+        CHECK(zcrc::parquet::verify(corrupted) == std::vector {parquet.size() - 8 - footer.size()});
+
+        // A footer whose row groups are a list of 2^64 - 1 booleans, which mustn't be taken at its word.
+        std::string huge_list {"PAR1\x49\xF1\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01\x00"sv};
+        append_le(huge_list, huge_list.size() - 4, 4);
+        huge_list += "PAR1";
+        CHECK(zcrc::parquet::verify(huge_list) == std::vector<std::size_t> {4});
+    }
+
+#if defined(ZCRC_TEST_ZLIB) && !defined(ZCRC_MODULE)
+    SECTION("zlib") {
+        std::string data;
+        for (std::size_t i {0}; data.size() < 200'000; ++i) {
+            data += std::to_string(i * i);
+        }
+        const auto compress {[&] (const int window_bits) {
+            z_stream stream {};
+            REQUIRE(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+            std::string out(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+            stream.next_in = reinterpret_cast<Bytef *>(data.data());
+            stream.avail_in = static_cast<uInt>(data.size());
+            stream.next_out = reinterpret_cast<Bytef *>(out.data());
+            stream.avail_out = static_cast<uInt>(out.size());
+            REQUIRE(deflate(&stream, Z_FINISH) == Z_STREAM_END);
+            out.resize(stream.total_out);
+            deflateEnd(&stream);
+            return out;
+        }};
+
+        const std::string member {compress(16 + 15)};
+        const std::string gzip {member + member};
+        CHECK(zcrc::gzip::verify(gzip, zcrc::zlib_inflate).empty());
+
+        auto corrupted {gzip};
+        corrupted[member.size() - 5] ^= 1;
+        CHECK(zcrc::gzip::verify(corrupted, zcrc::zlib_inflate) == std::vector<std::size_t> {0});
+
+        const std::string raw {compress(-15)};
+        std::vector<std::size_t> pieces;
+        const auto consumed {zcrc::zlib_inflate(
+            std::span {reinterpret_cast<const unsigned char *>(raw.data()), raw.size()},
+            [&] (const std::span<const unsigned char> piece) { pieces.push_back(piece.size()); })};
+        CHECK(consumed == raw.size());
+        std::size_t produced {0};
+        for (const std::size_t piece : pieces) {
+            produced += piece;
+        }
+        CHECK(produced == data.size());
+    }
+#endif
 }
 
 // These tests are mostly targeted at 32-bit code, but it doesn't hurt to run them
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+// Deliberately not <zlib.h>; we want to test the shim, not whatever zlib is installed.
+extern "C" {
+unsigned long crc32(unsigned long crc, const unsigned char * buf, unsigned int len);
+unsigned long crc32_z(unsigned long crc, const unsigned char * buf, std::size_t len);
+unsigned long crc32_combine(unsigned long crc1, unsigned long crc2, long len2);
+unsigned long crc32_combine64(unsigned long crc1, unsigned long crc2, std::int64_t len2);
+unsigned long crc32_combine_gen(long len2);
+unsigned long crc32_combine_gen64(std::int64_t len2);
+unsigned long crc32_combine_op(unsigned long crc1, unsigned long crc2, unsigned long op);
+}
+
+using namespace std::literals;
+
+namespace {
+
+[[nodiscard]] unsigned long crc32_of(const unsigned long crc, const std::string_view s) {
+    return crc32(crc, reinterpret_cast<const unsigned char *>(s.data()), static_cast<unsigned int>(s.size()));
+}
+
+} // namespace
+
+TEST_CASE("zlib shim: crc32 and crc32_z", "[zlib]") {
+    // zlib returns the initial CRC when given a null buffer.
+    CHECK(crc32(0, nullptr, 0) == 0);
+    CHECK(crc32(0xDEADBEEF, nullptr, 123) == 0);
+
+    CHECK(crc32_of(0, ""sv) == 0);
+    CHECK(crc32_of(0, "123456789"sv) == 0xCBF43926);
+    CHECK(crc32_of(0, "The quick brown fox jumps over the lazy dog"sv) == 0x414FA339);
+    CHECK(crc32_of(crc32_of(0, "The quick brown "sv), "fox jumps over the lazy dog"sv) == 0x414FA339);
+
+    constexpr std::string_view digits {"123456789"};
+    CHECK(crc32_z(0, reinterpret_cast<const unsigned char *>(digits.data()), digits.size()) == 0xCBF43926);
+}
+
+TEST_CASE("zlib shim: crc32_combine family", "[zlib]") {
+    constexpr std::string_view lhs {"The quick brown "};
+    constexpr std::string_view rhs {"fox jumps over the lazy dog"};
+    const unsigned long crc1 {crc32_of(0, lhs)};
+    const unsigned long crc2 {crc32_of(0, rhs)};
+    const auto len2 {static_cast<long>(rhs.size())};
+
+    CHECK(crc32_combine(crc1, crc2, len2) == 0x414FA339);
+    CHECK(crc32_combine64(crc1, crc2, len2) == 0x414FA339);
+    CHECK(crc32_combine_op(crc1, crc2, crc32_combine_gen(len2)) == 0x414FA339);
+    CHECK(crc32_combine_op(crc1, crc2, crc32_combine_gen64(len2)) == 0x414FA339);
+
+    // Combining with an empty message is the identity.
+    CHECK(crc32_combine(crc1, 0, 0) == crc1);
+    CHECK(crc32_combine_gen(0) == 0x80000000);
+
+    // Reference values from zlib 1.2.13.
+    CHECK(crc32_combine_gen64(1) == 0x00800000);
+    CHECK(crc32_combine_gen64(1000) == 0x107AAB28);
+    CHECK(crc32_combine_gen64(0x1'0000'0000) == 0x00800000);
+    CHECK(crc32_combine_gen64(123456789012) == 0xE4D66A03);
+}